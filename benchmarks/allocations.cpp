@@ -0,0 +1,80 @@
+#include "allocations.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace allocations {
+
+std::atomic<size_t> num_allocations = 0;
+
+size_t count() { return num_allocations.load(std::memory_order_relaxed); }
+
+}  // namespace allocations
+
+void* operator new(size_t _size) {
+  allocations::num_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(_size == 0 ? 1 : _size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](size_t _size) { return operator new(_size); }
+
+void operator delete(void* _ptr) noexcept { std::free(_ptr); }
+
+void operator delete[](void* _ptr) noexcept { std::free(_ptr); }
+
+void operator delete(void* _ptr, size_t) noexcept { std::free(_ptr); }
+
+void operator delete[](void* _ptr, size_t) noexcept { std::free(_ptr); }
+
+/// Over-aligned types are allocated through these overloads, so they have to
+/// be counted as well. std::aligned_alloc requires the size to be a multiple
+/// of the alignment.
+void* operator new(size_t _size, std::align_val_t _alignment) {
+  allocations::num_allocations.fetch_add(1, std::memory_order_relaxed);
+  const auto alignment = static_cast<size_t>(_alignment);
+  const auto size = (_size + alignment - 1) / alignment * alignment;
+#ifdef _WIN32
+  void* ptr = _aligned_malloc(size == 0 ? alignment : size, alignment);
+#else
+  void* ptr = std::aligned_alloc(alignment, size == 0 ? alignment : size);
+#endif
+  if (ptr) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](size_t _size, std::align_val_t _alignment) {
+  return operator new(_size, _alignment);
+}
+
+#ifdef _WIN32
+void operator delete(void* _ptr, std::align_val_t) noexcept {
+  _aligned_free(_ptr);
+}
+#else
+void operator delete(void* _ptr, std::align_val_t) noexcept {
+  std::free(_ptr);
+}
+#endif
+
+void operator delete[](void* _ptr, std::align_val_t _alignment) noexcept {
+  operator delete(_ptr, _alignment);
+}
+
+void operator delete(void* _ptr, size_t, std::align_val_t _alignment) noexcept {
+  operator delete(_ptr, _alignment);
+}
+
+void operator delete[](void* _ptr, size_t,
+                       std::align_val_t _alignment) noexcept {
+  operator delete(_ptr, _alignment);
+}
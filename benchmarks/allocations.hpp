@@ -0,0 +1,14 @@
+#ifndef BENCHMARKS_ALLOCATIONS_HPP_
+#define BENCHMARKS_ALLOCATIONS_HPP_
+
+#include <cstddef>
+
+namespace allocations {
+
+/// The total number of calls to the global operator new since the program
+/// started. The global operator new is replaced in allocations.cpp.
+size_t count();
+
+}  // namespace allocations
+
+#endif
@@ -0,0 +1,27 @@
+#include "bench_flexbuf.hpp"
+
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <vector>
+
+#include "run_backend.hpp"
+
+namespace bench_flexbuf {
+
+struct Backend {
+  static constexpr const char* name = "flexbuf";
+
+  template <class T>
+  static std::vector<char> write(const T& _obj) {
+    return rfl::flexbuf::write(_obj);
+  }
+
+  template <class T>
+  static rfl::Result<T> read(const std::vector<char>& _bytes) {
+    return rfl::flexbuf::read<T>(_bytes);
+  }
+};
+
+void run(const measure::Options& _options) { run_backend<Backend>(_options); }
+
+}  // namespace bench_flexbuf
@@ -0,0 +1,27 @@
+#include "bench_json.hpp"
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+
+#include "run_backend.hpp"
+
+namespace bench_json {
+
+struct Backend {
+  static constexpr const char* name = "json";
+
+  template <class T>
+  static std::string write(const T& _obj) {
+    return rfl::json::write(_obj);
+  }
+
+  template <class T>
+  static rfl::Result<T> read(const std::string& _bytes) {
+    return rfl::json::read<T>(_bytes);
+  }
+};
+
+void run(const measure::Options& _options) { run_backend<Backend>(_options); }
+
+}  // namespace bench_json
@@ -0,0 +1,118 @@
+#include "bench_number_strings.hpp"
+
+#include <cstring>
+#include <rfl.hpp>
+#include <rfl/internal/strings/NumberString.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef REFLECTCPP_XML
+#include <pugixml.hpp>
+#endif
+
+#include "payloads.hpp"
+
+/// Compares the two ways of formatting numbers as strings on the doubles
+/// payload. The XML writer and MapParser used to call std::to_string(...)
+/// and now use rfl::internal::strings::NumberString, which calls
+/// std::to_chars(...) on a buffer on the stack. Every family reproduces how
+/// one of the callers consumes the string.
+namespace bench_number_strings {
+
+struct ToString {
+  static constexpr const char* name = "to_string";
+
+  static std::string format(const double _val) { return std::to_string(_val); }
+};
+
+struct ToChars {
+  static constexpr const char* name = "NumberString";
+
+  static rfl::internal::strings::NumberString format(const double _val) {
+    return rfl::internal::strings::NumberString(_val);
+  }
+};
+
+std::string_view to_view(const std::string& _str) { return _str; }
+
+std::string_view to_view(const rfl::internal::strings::NumberString& _str) {
+  return _str.view();
+}
+
+/// MapParser passes the key to the writer as a std::string_view, which then
+/// copies it into the output.
+template <class Formatter>
+size_t write_map_keys(const std::vector<double>& _values,
+                      std::string* _buffer) {
+  _buffer->clear();
+  for (const auto val : _values) {
+    const auto key = Formatter::format(val);
+    _buffer->push_back('"');
+    _buffer->append(to_view(key));
+    _buffer->append("\":0,");
+  }
+  return _buffer->size();
+}
+
+template <class Formatter>
+void run_map_keys(const measure::Options& _options) {
+  if (!measure::selected(_options, Formatter::name, "map_keys")) {
+    return;
+  }
+  const auto& payload = payloads::doubles();
+  std::string buffer;
+  const auto bytes = write_map_keys<Formatter>(payload.value.values, &buffer);
+  const auto f = [&]() {
+    return write_map_keys<Formatter>(payload.value.values, &buffer);
+  };
+  measure::print_row(
+      Formatter::name, "map_keys", "write", bytes,
+      measure::run(_options, bytes, payload.num_objects, f));
+}
+
+#ifdef REFLECTCPP_XML
+/// The XML writer passes a null-terminated string to pugixml, which copies
+/// it into the node.
+template <class Formatter>
+size_t write_xml_values(const std::vector<double>& _values) {
+  pugi::xml_document doc;
+  auto root = doc.append_child("Doubles");
+  size_t bytes = 0;
+  for (const auto val : _values) {
+    const auto str = Formatter::format(val);
+    root.append_child("values")
+        .append_child(pugi::node_pcdata)
+        .set_value(str.c_str());
+    bytes += std::strlen(str.c_str());
+  }
+  return bytes;
+}
+
+template <class Formatter>
+void run_xml_values(const measure::Options& _options) {
+  if (!measure::selected(_options, Formatter::name, "xml_values")) {
+    return;
+  }
+  const auto& payload = payloads::doubles();
+  const auto bytes = write_xml_values<Formatter>(payload.value.values);
+  const auto f = [&]() {
+    return write_xml_values<Formatter>(payload.value.values);
+  };
+  measure::print_row(
+      Formatter::name, "xml_values", "write", bytes,
+      measure::run(_options, bytes, payload.num_objects, f));
+}
+#endif
+
+void run(const measure::Options& _options) {
+  run_map_keys<ToString>(_options);
+  run_map_keys<ToChars>(_options);
+
+#ifdef REFLECTCPP_XML
+  run_xml_values<ToString>(_options);
+  run_xml_values<ToChars>(_options);
+#endif
+}
+
+}  // namespace bench_number_strings
@@ -0,0 +1,27 @@
+#include "bench_xml.hpp"
+
+#include <rfl.hpp>
+#include <rfl/xml.hpp>
+#include <string>
+
+#include "run_backend.hpp"
+
+namespace bench_xml {
+
+struct Backend {
+  static constexpr const char* name = "xml";
+
+  template <class T>
+  static std::string write(const T& _obj) {
+    return rfl::xml::write(_obj);
+  }
+
+  template <class T>
+  static rfl::Result<T> read(const std::string& _bytes) {
+    return rfl::xml::read<T>(_bytes);
+  }
+};
+
+void run(const measure::Options& _options) { run_backend<Backend>(_options); }
+
+}  // namespace bench_xml
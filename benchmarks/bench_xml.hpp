@@ -0,0 +1,5 @@
+#include "measure.hpp"
+
+namespace bench_xml {
+void run(const measure::Options& _options);
+}
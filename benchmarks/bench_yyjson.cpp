@@ -0,0 +1,144 @@
+#include "bench_yyjson.hpp"
+
+#include <yyjson.h>
+
+#include <cstdlib>
+#include <rfl.hpp>
+#include <string>
+#include <type_traits>
+
+#include "run_backend.hpp"
+
+/// Hand-written code using yyjson directly, producing and consuming the same
+/// JSON as rfl::json. The difference to the "json" backend is the overhead
+/// introduced by reflect-cpp.
+namespace bench_yyjson {
+
+using payloads::Doubles;
+using payloads::Flat;
+using payloads::FlatObjects;
+
+std::string to_string(yyjson_mut_doc* _doc) {
+  size_t len = 0;
+  char* json = yyjson_mut_write(_doc, 0, &len);
+  yyjson_mut_doc_free(_doc);
+  if (!json) {
+    return std::string();
+  }
+  std::string str(json, len);
+  std::free(json);
+  return str;
+}
+
+std::string write_flat(const FlatObjects& _flat) {
+  yyjson_mut_doc* doc = yyjson_mut_doc_new(NULL);
+  yyjson_mut_val* root = yyjson_mut_obj(doc);
+  yyjson_mut_doc_set_root(doc, root);
+  yyjson_mut_val* arr = yyjson_mut_arr(doc);
+  yyjson_mut_obj_add_val(doc, root, "objects", arr);
+  for (const auto& obj : _flat.objects) {
+    yyjson_mut_val* val = yyjson_mut_arr_add_obj(doc, arr);
+    yyjson_mut_obj_add_sint(doc, val, "id", obj.id);
+    yyjson_mut_obj_add_strn(doc, val, "name", obj.name.data(),
+                            obj.name.size());
+    yyjson_mut_obj_add_strn(doc, val, "email", obj.email.data(),
+                            obj.email.size());
+    yyjson_mut_obj_add_real(doc, val, "score", obj.score);
+    yyjson_mut_obj_add_real(doc, val, "ratio", obj.ratio);
+    yyjson_mut_obj_add_int(doc, val, "count", obj.count);
+    yyjson_mut_obj_add_bool(doc, val, "active", obj.active);
+  }
+  return to_string(doc);
+}
+
+std::string write_doubles(const Doubles& _doubles) {
+  yyjson_mut_doc* doc = yyjson_mut_doc_new(NULL);
+  yyjson_mut_val* root = yyjson_mut_obj(doc);
+  yyjson_mut_doc_set_root(doc, root);
+  yyjson_mut_val* arr = yyjson_mut_arr(doc);
+  yyjson_mut_obj_add_val(doc, root, "values", arr);
+  for (const double v : _doubles.values) {
+    yyjson_mut_arr_add_real(doc, arr, v);
+  }
+  return to_string(doc);
+}
+
+std::string get_string(yyjson_val* _obj, const char* _key) {
+  yyjson_val* val = yyjson_obj_get(_obj, _key);
+  return std::string(yyjson_get_str(val), yyjson_get_len(val));
+}
+
+rfl::Result<FlatObjects> read_flat(yyjson_val* _root) {
+  yyjson_val* arr = yyjson_obj_get(_root, "objects");
+  if (!yyjson_is_arr(arr)) {
+    return rfl::Error("Expected an array.");
+  }
+  FlatObjects flat;
+  flat.objects.reserve(yyjson_arr_size(arr));
+  size_t idx = 0, max = 0;
+  yyjson_val* val = nullptr;
+  yyjson_arr_foreach(arr, idx, max, val) {
+    flat.objects.push_back(Flat{
+        .id = yyjson_get_sint(yyjson_obj_get(val, "id")),
+        .name = get_string(val, "name"),
+        .email = get_string(val, "email"),
+        .score = yyjson_get_num(yyjson_obj_get(val, "score")),
+        .ratio =
+            static_cast<float>(yyjson_get_num(yyjson_obj_get(val, "ratio"))),
+        .count = yyjson_get_int(yyjson_obj_get(val, "count")),
+        .active = yyjson_get_bool(yyjson_obj_get(val, "active"))});
+  }
+  return flat;
+}
+
+rfl::Result<Doubles> read_doubles(yyjson_val* _root) {
+  yyjson_val* arr = yyjson_obj_get(_root, "values");
+  if (!yyjson_is_arr(arr)) {
+    return rfl::Error("Expected an array.");
+  }
+  Doubles doubles;
+  doubles.values.reserve(yyjson_arr_size(arr));
+  size_t idx = 0, max = 0;
+  yyjson_val* val = nullptr;
+  yyjson_arr_foreach(arr, idx, max, val) {
+    doubles.values.push_back(yyjson_get_num(val));
+  }
+  return doubles;
+}
+
+struct Backend {
+  static constexpr const char* name = "yyjson (raw)";
+
+  static std::string write(const FlatObjects& _flat) {
+    return write_flat(_flat);
+  }
+
+  static std::string write(const Doubles& _doubles) {
+    return write_doubles(_doubles);
+  }
+
+  template <class T>
+  static rfl::Result<T> read(const std::string& _bytes) {
+    yyjson_doc* doc = yyjson_read(_bytes.c_str(), _bytes.size(), 0);
+    if (!doc) {
+      return rfl::Error("Could not parse document");
+    }
+    yyjson_val* root = yyjson_doc_get_root(doc);
+    auto res = [&]() {
+      if constexpr (std::is_same<T, FlatObjects>()) {
+        return read_flat(root);
+      } else {
+        return read_doubles(root);
+      }
+    }();
+    yyjson_doc_free(doc);
+    return res;
+  }
+};
+
+void run(const measure::Options& _options) {
+  run_family<Backend>(_options, "flat", payloads::flat());
+  run_family<Backend>(_options, "doubles", payloads::doubles());
+}
+
+}  // namespace bench_yyjson
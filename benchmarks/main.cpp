@@ -0,0 +1,53 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "bench_json.hpp"
+#include "bench_number_strings.hpp"
+#include "bench_yyjson.hpp"
+#include "measure.hpp"
+
+#ifdef REFLECTCPP_FLEXBUFFERS
+#include "bench_flexbuf.hpp"
+#endif
+
+#ifdef REFLECTCPP_XML
+#include "bench_xml.hpp"
+#endif
+
+int main(int argc, char* argv[]) {
+  measure::Options options;
+
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+      options.min_time = std::chrono::milliseconds(std::atoi(argv[++i]));
+    } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+      options.filter = argv[++i];
+    } else {
+      std::cout << "Usage: " << argv[0]
+                << " [--filter <backend/family>] [--min-time-ms <ms>]"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  measure::print_header();
+
+  bench_yyjson::run(options);
+
+  bench_json::run(options);
+
+  bench_number_strings::run(options);
+
+#ifdef REFLECTCPP_FLEXBUFFERS
+  bench_flexbuf::run(options);
+#endif
+
+#ifdef REFLECTCPP_XML
+  bench_xml::run(options);
+#endif
+
+  return 0;
+}
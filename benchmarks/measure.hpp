@@ -0,0 +1,87 @@
+#ifndef BENCHMARKS_MEASURE_HPP_
+#define BENCHMARKS_MEASURE_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include "allocations.hpp"
+
+namespace measure {
+
+/// Set from the command line in main.cpp.
+struct Options {
+  /// Only benchmarks containing this string in "<backend>/<family>" are run.
+  std::string filter;
+
+  /// The minimum time spent on every single measurement.
+  std::chrono::milliseconds min_time = std::chrono::milliseconds(500);
+};
+
+struct Measurement {
+  double mb_per_s;
+  double ns_per_object;
+  double allocs_per_object;
+};
+
+/// Used to prevent the compiler from optimizing the benchmarked code away.
+inline volatile size_t sink = 0;
+
+inline bool selected(const Options& _options, const std::string& _backend,
+                     const std::string& _family) {
+  return (_backend + "/" + _family).find(_options.filter) != std::string::npos;
+}
+
+/// Calls _f repeatedly until at least _options.min_time has passed. _f must
+/// return a size_t that depends on the result of the benchmarked operation.
+/// _bytes is the size of the serialized payload and _num_objects the number
+/// of objects it contains.
+template <class F>
+Measurement run(const Options& _options, const size_t _bytes,
+                const size_t _num_objects, const F& _f) {
+  using Clock = std::chrono::steady_clock;
+
+  // Warm up the caches and the allocator.
+  sink = sink + _f();
+
+  const auto allocs_before = allocations::count();
+  const auto begin = Clock::now();
+
+  size_t iterations = 0;
+  auto elapsed = Clock::duration::zero();
+
+  do {
+    sink = sink + _f();
+    ++iterations;
+    elapsed = Clock::now() - begin;
+  } while (elapsed < _options.min_time);
+
+  const auto allocs = allocations::count() - allocs_before;
+
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  const double objects = static_cast<double>(iterations * _num_objects);
+
+  return Measurement{
+      .mb_per_s = static_cast<double>(iterations * _bytes) / seconds / 1.0e6,
+      .ns_per_object = seconds * 1.0e9 / objects,
+      .allocs_per_object = static_cast<double>(allocs) / objects};
+}
+
+inline void print_header() {
+  std::printf("%-14s %-12s %-6s %12s %12s %12s %14s\n", "backend", "family",
+              "op", "bytes", "MB/s", "ns/object", "allocs/object");
+}
+
+inline void print_row(const std::string& _backend, const std::string& _family,
+                      const std::string& _op, const size_t _bytes,
+                      const Measurement& _m) {
+  std::printf("%-14s %-12s %-6s %12zu %12.1f %12.1f %14.2f\n",
+              _backend.c_str(), _family.c_str(), _op.c_str(), _bytes,
+              _m.mb_per_s, _m.ns_per_object, _m.allocs_per_object);
+  std::fflush(stdout);
+}
+
+}  // namespace measure
+
+#endif
@@ -0,0 +1,173 @@
+#include "payloads.hpp"
+
+#include <cstdio>
+#include <ctime>
+#include <random>
+
+namespace payloads {
+
+/// std::mt19937_64 produces the same sequence on every platform, but the
+/// standard distributions do not, so we derive all values from the raw
+/// output ourselves.
+class Generator {
+ public:
+  Generator() : rng_(42) {}
+
+  std::int64_t integer(const std::int64_t _min, const std::int64_t _max) {
+    return _min + static_cast<std::int64_t>(
+                      rng_() % static_cast<std::uint64_t>(_max - _min + 1));
+  }
+
+  double uniform() {
+    return static_cast<double>(rng_() >> 11) * (1.0 / 9007199254740992.0);
+  }
+
+  std::string word(const size_t _min_length, const size_t _max_length) {
+    const auto length = static_cast<size_t>(integer(
+        static_cast<std::int64_t>(_min_length),
+        static_cast<std::int64_t>(_max_length)));
+    std::string str(length, ' ');
+    for (auto& c : str) {
+      c = static_cast<char>('a' + integer(0, 25));
+    }
+    return str;
+  }
+
+ private:
+  std::mt19937_64 rng_;
+};
+
+Node make_node(const size_t _depth, Generator* _gen) {
+  auto node = Node{.name = _gen->word(4, 12), .value = _gen->uniform()};
+  if (_depth > 0) {
+    node.children.push_back(make_node(_depth - 1, _gen));
+    node.children.push_back(make_node(_depth - 1, _gen));
+  }
+  return node;
+}
+
+std::tm make_tm(Generator* _gen) {
+  std::tm tm{};
+  tm.tm_year = static_cast<int>(_gen->integer(100, 130));
+  tm.tm_mon = static_cast<int>(_gen->integer(0, 11));
+  tm.tm_mday = static_cast<int>(_gen->integer(1, 28));
+  tm.tm_hour = static_cast<int>(_gen->integer(0, 23));
+  tm.tm_min = static_cast<int>(_gen->integer(0, 59));
+  tm.tm_sec = static_cast<int>(_gen->integer(0, 59));
+  return tm;
+}
+
+const Payload<FlatObjects>& flat() {
+  static const auto payload = []() {
+    constexpr size_t num_objects = 10000;
+    Generator gen;
+    FlatObjects flat_objects;
+    for (size_t i = 0; i < num_objects; ++i) {
+      flat_objects.objects.push_back(
+          Flat{.id = static_cast<std::int64_t>(i),
+               .name = gen.word(4, 16),
+               .email = gen.word(4, 12) + "@" + gen.word(4, 8) + ".com",
+               .score = gen.uniform() * 100.0,
+               .ratio = static_cast<float>(gen.uniform()),
+               .count = static_cast<int>(gen.integer(-1000, 1000)),
+               .active = gen.integer(0, 1) == 1});
+    }
+    return Payload<FlatObjects>{std::move(flat_objects), num_objects};
+  }();
+  return payload;
+}
+
+const Payload<Deep>& deep() {
+  static const auto payload = []() {
+    // A complete binary tree of depth 12 has 2^13 - 1 nodes.
+    constexpr size_t depth = 12;
+    Generator gen;
+    return Payload<Deep>{Deep{.root = make_node(depth, &gen)},
+                         (size_t(1) << (depth + 1)) - 1};
+  }();
+  return payload;
+}
+
+const Payload<Doubles>& doubles() {
+  static const auto payload = []() {
+    constexpr size_t num_objects = 1 << 18;
+    Generator gen;
+    Doubles doubles;
+    doubles.values.reserve(num_objects);
+    for (size_t i = 0; i < num_objects; ++i) {
+      doubles.values.push_back((gen.uniform() - 0.5) * 2.0e6);
+    }
+    return Payload<Doubles>{std::move(doubles), num_objects};
+  }();
+  return payload;
+}
+
+const Payload<StringMap>& string_map() {
+  static const auto payload = []() {
+    constexpr size_t num_objects = 10000;
+    Generator gen;
+    StringMap string_map;
+    char key[32];
+    for (size_t i = 0; i < num_objects; ++i) {
+      std::snprintf(key, sizeof(key), "key_%06zu", i);
+      string_map.entries[key] = gen.word(8, 64);
+    }
+    return Payload<StringMap>{std::move(string_map), num_objects};
+  }();
+  return payload;
+}
+
+const Payload<Shapes>& shapes() {
+  static const auto payload = []() {
+    constexpr size_t num_objects = 10000;
+    Generator gen;
+    Shapes shapes;
+    for (size_t i = 0; i < num_objects; ++i) {
+      switch (gen.integer(0, 2)) {
+        case 0:
+          shapes.shapes.push_back(Circle{.radius = gen.uniform()});
+          break;
+        case 1:
+          shapes.shapes.push_back(
+              Rectangle{.height = gen.uniform(), .width = gen.uniform()});
+          break;
+        default:
+          shapes.shapes.push_back(Square{.width = gen.uniform()});
+          break;
+      }
+    }
+    return Payload<Shapes>{std::move(shapes), num_objects};
+  }();
+  return payload;
+}
+
+const Payload<Enums>& enums() {
+  static const auto payload = []() {
+    constexpr size_t num_objects = 10000;
+    Generator gen;
+    Enums enums;
+    for (size_t i = 0; i < num_objects; ++i) {
+      enums.pixels.push_back(
+          Pixel{.color = static_cast<Color>(gen.integer(0, 5)),
+                .weekday = static_cast<Weekday>(gen.integer(0, 6))});
+    }
+    return Payload<Enums>{std::move(enums), num_objects};
+  }();
+  return payload;
+}
+
+const Payload<Events>& events() {
+  static const auto payload = []() {
+    constexpr size_t num_objects = 10000;
+    Generator gen;
+    Events events;
+    for (size_t i = 0; i < num_objects; ++i) {
+      events.events.push_back(
+          Event{.name = gen.word(4, 16), .time = make_tm(&gen)});
+    }
+    return Payload<Events>{std::move(events), num_objects};
+  }();
+  return payload;
+}
+
+}  // namespace payloads
@@ -0,0 +1,120 @@
+#ifndef BENCHMARKS_PAYLOADS_HPP_
+#define BENCHMARKS_PAYLOADS_HPP_
+
+#include <cstdint>
+#include <map>
+#include <rfl.hpp>
+#include <string>
+#include <vector>
+
+/// Deterministic synthetic payloads, one for every type family. They are
+/// generated from a fixed seed, so every run and every backend sees exactly
+/// the same data.
+namespace payloads {
+
+struct Flat {
+  std::int64_t id;
+  std::string name;
+  std::string email;
+  double score;
+  float ratio;
+  int count;
+  bool active;
+};
+
+struct FlatObjects {
+  std::vector<Flat> objects;
+};
+
+struct Node {
+  std::string name;
+  double value;
+  std::vector<Node> children;
+};
+
+struct Deep {
+  Node root;
+};
+
+struct Doubles {
+  std::vector<double> values;
+};
+
+struct StringMap {
+  std::map<std::string, std::string> entries;
+};
+
+struct Circle {
+  double radius;
+};
+
+struct Rectangle {
+  double height;
+  double width;
+};
+
+struct Square {
+  double width;
+};
+
+using Shape = rfl::TaggedUnion<"shape", Circle, Rectangle, Square>;
+
+struct Shapes {
+  std::vector<Shape> shapes;
+};
+
+enum class Color { red, green, blue, yellow, cyan, magenta };
+
+enum class Weekday {
+  monday,
+  tuesday,
+  wednesday,
+  thursday,
+  friday,
+  saturday,
+  sunday
+};
+
+struct Pixel {
+  Color color;
+  Weekday weekday;
+};
+
+struct Enums {
+  std::vector<Pixel> pixels;
+};
+
+struct Event {
+  std::string name;
+  rfl::Timestamp<"%Y-%m-%d %H:%M:%S"> time;
+};
+
+struct Events {
+  std::vector<Event> events;
+};
+
+/// A payload together with the number of objects it contains, which is
+/// needed to compute the time and allocations per object.
+template <class T>
+struct Payload {
+  T value;
+  size_t num_objects;
+};
+
+const Payload<FlatObjects>& flat();
+
+const Payload<Deep>& deep();
+
+const Payload<Doubles>& doubles();
+
+const Payload<StringMap>& string_map();
+
+const Payload<Shapes>& shapes();
+
+const Payload<Enums>& enums();
+
+const Payload<Events>& events();
+
+}  // namespace payloads
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef BENCHMARKS_RUN_BACKEND_HPP_
+#define BENCHMARKS_RUN_BACKEND_HPP_
+
+#include <iostream>
+#include <string>
+
+#include "measure.hpp"
+#include "payloads.hpp"
+
+/// Measures reading and writing a single payload. Backend must provide a
+/// static member `name`, a static function `write(const T&)` returning a
+/// container of bytes and a static function template `read<T>(bytes)`.
+template <class Backend, class T>
+void run_family(const measure::Options& _options, const std::string& _family,
+                const payloads::Payload<T>& _payload) {
+  if (!measure::selected(_options, Backend::name, _family)) {
+    return;
+  }
+
+  const auto bytes = Backend::write(_payload.value);
+
+  const auto res = Backend::template read<T>(bytes);
+
+  if (!res) {
+    std::cout << Backend::name << "/" << _family
+              << ": Could not read the payload. Error: "
+              << res.error().value().what() << std::endl;
+    return;
+  }
+
+  const auto write = [&]() { return Backend::write(_payload.value).size(); };
+
+  const auto read = [&]() -> size_t {
+    return Backend::template read<T>(bytes) ? 1 : 0;
+  };
+
+  measure::print_row(
+      Backend::name, _family, "write", bytes.size(),
+      measure::run(_options, bytes.size(), _payload.num_objects, write));
+
+  measure::print_row(
+      Backend::name, _family, "read", bytes.size(),
+      measure::run(_options, bytes.size(), _payload.num_objects, read));
+}
+
+/// Runs every type family for a backend.
+template <class Backend>
+void run_backend(const measure::Options& _options) {
+  run_family<Backend>(_options, "flat", payloads::flat());
+  run_family<Backend>(_options, "deep", payloads::deep());
+  run_family<Backend>(_options, "doubles", payloads::doubles());
+  run_family<Backend>(_options, "string_map", payloads::string_map());
+  run_family<Backend>(_options, "shapes", payloads::shapes());
+  run_family<Backend>(_options, "enums", payloads::enums());
+  run_family<Backend>(_options, "events", payloads::events());
+}
+
+#endif
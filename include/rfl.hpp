@@ -16,6 +16,7 @@
 #include "rfl/Literal.hpp"
 #include "rfl/NamedTuple.hpp"
 #include "rfl/OneOf.hpp"
+#include "rfl/Parallel.hpp"
 #include "rfl/Pattern.hpp"
 #include "rfl/PatternValidator.hpp"
 #include "rfl/Ref.hpp"
@@ -45,6 +46,7 @@
 #include "rfl/patterns.hpp"
 #include "rfl/remove_fields.hpp"
 #include "rfl/replace.hpp"
+#include "rfl/stats.hpp"
 #include "rfl/to_named_tuple.hpp"
 #include "rfl/to_view.hpp"
 #include "rfl/type_name_t.hpp"
@@ -17,7 +17,8 @@ struct Attribute {
   using Type = T;
   using ReflectionType = T;
 
-  Attribute() : value_(Type()) {}
+  Attribute() noexcept(std::is_nothrow_default_constructible_v<Type>)
+      : value_() {}
 
   Attribute(const Type& _value) : value_(_value) {}
 
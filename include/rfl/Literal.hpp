@@ -1,15 +1,18 @@
 #ifndef RFL_LITERAL_HPP_
 #define RFL_LITERAL_HPP_
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 
 #include "rfl/Result.hpp"
+#include "rfl/internal/StringHashTable.hpp"
 #include "rfl/internal/StringLiteral.hpp"
 #include "rfl/internal/VisitTree.hpp"
 
@@ -48,7 +51,7 @@ class Literal {
   /// can also have a default constructor.
   template <ValueType num_fields = num_fields_,
             typename = std::enable_if_t<num_fields == 1>>
-  Literal() : value_(0) {}
+  Literal() noexcept : value_(0) {}
 
   ~Literal() = default;
 
@@ -81,7 +84,15 @@ class Literal {
   }
 
   /// Determines whether the literal contains the string.
-  static bool contains(const std::string& _str) { return has_value(_str); }
+  static bool contains(const std::string_view& _str) {
+    return has_value(_str);
+  }
+
+  /// Returns the value associated with the string or -1, if the literal does
+  /// not contain it. Unlike from_string(...), this never builds an error.
+  static int index_of(const std::string_view& _str) {
+    return values_.find(_str);
+  }
 
   /// Determines whether the literal contains the string at compile time.
   template <internal::StringLiteral _name>
@@ -124,7 +135,7 @@ class Literal {
 
   /// Constructs a Literal from a string. Returns an error if the string
   /// cannot be found.
-  static Result<Literal> from_string(const std::string& _str) {
+  static Result<Literal> from_string(const std::string_view& _str) {
     const auto to_literal = [](const auto& _v) {
       return Literal<fields_...>(_v);
     };
@@ -132,7 +143,16 @@ class Literal {
   };
 
   /// The name defined by the Literal.
-  std::string name() const { return find_name(); }
+  std::string name() const { return std::string(name_view()); }
+
+  /// The name defined by the Literal, without copying it. The view points
+  /// to static storage, so it never dangles.
+  std::string_view name_view() const { return names_[value_]; }
+
+  /// The names of all fields, indexed by their value.
+  static constexpr const std::array<std::string_view, num_fields_>& names() {
+    return names_;
+  }
 
   /// Helper function to retrieve a name at compile time.
   template <int _value>
@@ -184,16 +204,17 @@ class Literal {
   Literal(const ValueType _value) : value_(_value) {}
 
   /// Returns all of the allowed fields.
-  template <int _i = 0>
-  static std::string allowed_strings(const std::string& _values = "") {
-    using FieldType = typename std::tuple_element<_i, FieldsType>::type;
-    const auto head = "'" + FieldType::field_.str() + "'";
-    const auto values = _values.size() == 0 ? head : _values + ", " + head;
-    if constexpr (_i + 1 < num_fields_) {
-      return allowed_strings<_i + 1>(values);
-    } else {
-      return values;
+  static std::string allowed_strings() {
+    std::string values;
+    for (const auto& name : names_) {
+      if (values.size() != 0) {
+        values += ", ";
+      }
+      values += "'";
+      values += name;
+      values += "'";
     }
+    return values;
   }
 
   /// Whether the Literal contains duplicate strings.
@@ -219,21 +240,6 @@ class Literal {
     }
   }
 
-  /// Finds the correct index associated with
-  /// the string at run time.
-  template <int _i = 0>
-  std::string find_name() const {
-    if (_i == value_) {
-      using FieldType = typename std::tuple_element<_i, FieldsType>::type;
-      return FieldType::field_.str();
-    }
-    if constexpr (_i + 1 == num_fields_) {
-      return "";
-    } else {
-      return find_name<_i + 1>();
-    }
-  }
-
   /// Finds the correct index associated with
   /// the string at compile time within the Literal's own fields.
   template <int _i>
@@ -244,19 +250,14 @@ class Literal {
 
   /// Finds the correct value associated with
   /// the string at run time.
-  template <int _i = 0>
-  static Result<int> find_value(const std::string& _str) {
-    using FieldType = typename std::tuple_element<_i, FieldsType>::type;
-    if (FieldType::field_.str() == _str) {
-      return _i;
-    }
-    if constexpr (_i + 1 == num_fields_) {
-      return Error(
-          "Literal does not support string '" + _str +
-          "'. The following strings are supported: " + allowed_strings() + ".");
-    } else {
-      return find_value<_i + 1>(_str);
+  static Result<int> find_value(const std::string_view& _str) {
+    const auto value = values_.find(_str);
+    if (value == -1) {
+      return Error("Literal does not support string '" + std::string(_str) +
+                   "'. The following strings are supported: " +
+                   allowed_strings() + ".");
     }
+    return value;
   }
 
   /// Finds the value of a string literal at compile time.
@@ -273,17 +274,8 @@ class Literal {
   }
 
   /// Whether the literal contains this string.
-  template <int _i = 0>
-  static bool has_value(const std::string& _str) {
-    using FieldType = typename std::tuple_element<_i, FieldsType>::type;
-    if (FieldType::field_.str() == _str) {
-      return true;
-    }
-    if constexpr (_i + 1 == num_fields_) {
-      return false;
-    } else {
-      return has_value<_i + 1>(_str);
-    }
+  static bool has_value(const std::string_view& _str) {
+    return values_.find(_str) != -1;
   }
 
   static_assert(sizeof...(fields_) > 0,
@@ -295,6 +287,14 @@ class Literal {
   static_assert(!has_duplicates(),
                 "Duplicate strings are not allowed in a Literal.");
 
+  /// The names of the fields, indexed by their value.
+  static constexpr std::array<std::string_view, num_fields_> names_ = {
+      fields_.string_view()...};
+
+  /// Maps the names to their values. This is generated at compile time.
+  static constexpr internal::StringHashTable<num_fields_> values_ =
+      internal::StringHashTable<num_fields_>(names_);
+
  private:
   /// The underlying value.
   ValueType value_;
@@ -0,0 +1,19 @@
+#ifndef RFL_PARALLEL_HPP_
+#define RFL_PARALLEL_HPP_
+
+#include <cstddef>
+
+namespace rfl {
+
+/// Can be passed to read(...) to parse the elements of a top-level
+/// std::vector concurrently, for instance
+/// rfl::json::read<std::vector<Person>>(json_str, rfl::Parallel{8}).
+struct Parallel {
+  /// The number of threads to use. 0 means that
+  /// std::thread::hardware_concurrency() is used.
+  size_t threads = 0;
+};
+
+}  // namespace rfl
+
+#endif
@@ -22,7 +22,8 @@ struct Rename {
   /// The name of the field.
   using Name = rfl::Literal<_name>;
 
-  Rename() : value_(Type()) {}
+  Rename() noexcept(std::is_nothrow_default_constructible_v<Type>)
+      : value_() {}
 
   Rename(const Type& _value) : value_(_value) {}
 
@@ -1,9 +1,12 @@
 #ifndef RFL_RESULT_HPP_
 #define RFL_RESULT_HPP_
 
+#include <memory>
 #include <optional>
 #include <ranges>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <variant>
@@ -14,16 +17,160 @@ namespace rfl {
 /// To be returned
 class Error {
  public:
-  Error(const std::string& _what) : what_(_what) {}
+  /// Signifies what kind of error this is. All errors other than
+  /// Code::message are composed of parts that are cheap to copy and their
+  /// messages are only rendered when what() is called for the first time.
+  /// This matters when parsing variants, because most of the errors are
+  /// discarded as soon as one of the alternatives matches.
+  enum class Code {
+    message,
+    field_not_found,
+    field_failed,
+    context,
+    multiple,
+    no_alternative
+  };
+
+ public:
+  Error(const std::string& _what)
+      : code_(Code::message), is_rendered_(true), what_(_what) {}
 
   ~Error() = default;
 
+  /// An error with a message that has static storage duration, such as a
+  /// string literal. The message is not copied until what() is called.
+  static Error from_static(const std::string_view& _what) noexcept {
+    return Error(Code::message, _what, nullptr);
+  }
+
+  /// A required field could not be found. _field must have static storage
+  /// duration, like the field names of a NamedTuple.
+  static Error field_not_found(const std::string_view& _field) noexcept {
+    return Error(Code::field_not_found, _field, nullptr);
+  }
+
+  /// A field could not be parsed because of _cause. _field must have static
+  /// storage duration, like the field names of a NamedTuple.
+  static Error field_failed(const std::string_view& _field, Error&& _cause) {
+    return Error(Code::field_failed, _field,
+                 std::make_shared<const std::vector<Error>>(
+                     std::vector<Error>({std::move(_cause)})));
+  }
+
+  /// _cause occurred in the context described by _context, which is put in
+  /// front of its message. _context must have static storage duration.
+  static Error with_context(const std::string_view& _context,
+                            Error&& _cause) {
+    return Error(Code::context, _context,
+                 std::make_shared<const std::vector<Error>>(
+                     std::vector<Error>({std::move(_cause)})));
+  }
+
+  /// Several errors occurred at once, for instance in different fields of
+  /// the same object.
+  static Error multiple(std::vector<Error>&& _errors) {
+    return Error(Code::multiple, std::string_view(),
+                 std::make_shared<const std::vector<Error>>(
+                     std::move(_errors)));
+  }
+
+  /// None of the alternatives matched. _intro must have static storage
+  /// duration and precedes the list of errors.
+  static Error no_alternative(const std::string_view& _intro,
+                              std::vector<Error>&& _errors) {
+    return Error(Code::no_alternative, _intro,
+                 std::make_shared<const std::vector<Error>>(
+                     std::move(_errors)));
+  }
+
+  /// Signifies what kind of error this is.
+  Code code() const noexcept { return code_; }
+
   /// Returns the error message, equivalent to .what() in std::exception.
-  const std::string& what() const { return what_; }
+  /// The message is rendered on the first call and cached in this object.
+  /// Copies do not share that cache, so different copies can be used from
+  /// different threads, but a single object must not be used concurrently,
+  /// just like a std::string.
+  const std::string& what() const {
+    if (!is_rendered_) {
+      what_ = render();
+      is_rendered_ = true;
+    }
+    return what_;
+  }
+
+ private:
+  Error(const Code _code, const std::string_view& _text,
+        std::shared_ptr<const std::vector<Error>>&& _causes) noexcept
+      : causes_(std::move(_causes)),
+        code_(_code),
+        is_rendered_(false),
+        text_(_text) {}
+
+  std::string render() const {
+    switch (code_) {
+      case Code::field_not_found:
+        return "Field named '" + std::string(text_) + "' not found.";
+
+      case Code::field_failed:
+        return "Failed to parse field '" + std::string(text_) +
+               "': " + causes_->at(0).render_uncached();
+
+      case Code::context:
+        return std::string(text_) + causes_->at(0).render_uncached();
+
+      case Code::multiple:
+        return "Found " + std::to_string(causes_->size()) + " errors:" +
+               render_list();
+
+      case Code::no_alternative:
+        return std::string(text_) + render_list();
+
+      default:
+        return std::string(text_);
+    }
+  }
+
+  /// Returns the message without caching it. The causes are shared between
+  /// all copies of an error, so they must never write to their own cache.
+  std::string render_uncached() const {
+    return is_rendered_ ? what_ : render();
+  }
+
+  /// Renders the causes as a numbered list, indenting nested lists.
+  std::string render_list() const {
+    std::string list;
+    for (size_t i = 0; i < causes_->size(); ++i) {
+      list += '\n';
+      list += std::to_string(i + 1);
+      list += ") ";
+      const auto what = causes_->at(i).render_uncached();
+      for (const char c : what) {
+        if (c == '\n') {
+          list += "\n    ";
+        } else {
+          list += c;
+        }
+      }
+    }
+    return list;
+  }
 
  private:
+  /// The errors that caused this one, if any.
+  std::shared_ptr<const std::vector<Error>> causes_;
+
+  /// Signifies what kind of error this is.
+  Code code_;
+
+  /// Whether what_ contains the rendered message.
+  mutable bool is_rendered_;
+
+  /// The static part of the message, such as the name of a field.
+  std::string_view text_;
+
   /// Documents what went wrong
-  std::string what_;
+  mutable std::string what_;
 };
 
 /// Can be used when we are simply interested in whether an operation was
@@ -2,6 +2,7 @@
 #define RFL_COMPARISONS_HPP_
 
 #include "rfl/Result.hpp"
+#include "rfl/internal/strings/NumberString.hpp"
 
 namespace rfl {
 
@@ -12,8 +13,9 @@ struct EqualTo {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value != threshold) {
       return Error("Value expected to be equal to " +
-                   std::to_string(threshold) + ", but got " +
-                   std::to_string(_value) + ".");
+                   internal::strings::NumberString(threshold).str() +
+                   ", but got " +
+                   internal::strings::NumberString(_value).str() + ".");
     }
     return _value;
   }
@@ -26,8 +28,9 @@ struct Minimum {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value < threshold) {
       return Error("Value expected to be greater than or equal to " +
-                   std::to_string(threshold) + ", but got " +
-                   std::to_string(_value) + ".");
+                   internal::strings::NumberString(threshold).str() +
+                   ", but got " +
+                   internal::strings::NumberString(_value).str() + ".");
     }
     return _value;
   }
@@ -40,8 +43,9 @@ struct ExclusiveMinimum {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value <= threshold) {
       return Error("Value expected to be greater than " +
-                   std::to_string(threshold) + ", but got " +
-                   std::to_string(_value) + ".");
+                   internal::strings::NumberString(threshold).str() +
+                   ", but got " +
+                   internal::strings::NumberString(_value).str() + ".");
     }
     return _value;
   }
@@ -54,8 +58,9 @@ struct Maximum {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value > threshold) {
       return Error("Value expected to be less than or equal to " +
-                   std::to_string(threshold) + ", but got " +
-                   std::to_string(_value) + ".");
+                   internal::strings::NumberString(threshold).str() +
+                   ", but got " +
+                   internal::strings::NumberString(_value).str() + ".");
     }
     return _value;
   }
@@ -68,8 +73,9 @@ struct ExclusiveMaximum {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value >= threshold) {
       return Error("Value expected to be less than " +
-                   std::to_string(threshold) + ", but got " +
-                   std::to_string(_value) + ".");
+                   internal::strings::NumberString(threshold).str() +
+                   ", but got " +
+                   internal::strings::NumberString(_value).str() + ".");
     }
     return _value;
   }
@@ -82,8 +88,9 @@ struct NotEqualTo {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value == threshold) {
       return Error("Value expected to not be equal to " +
-                   std::to_string(threshold) + ", but got " +
-                   std::to_string(_value) + ".");
+                   internal::strings::NumberString(threshold).str() +
+                   ", but got " +
+                   internal::strings::NumberString(_value).str() + ".");
     }
     return _value;
   }
@@ -3,8 +3,12 @@
 
 #include <flatbuffers/flexbuffers.h>
 
+#include <bit>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <map>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -41,16 +45,25 @@ struct Reader {
   template <class T>
   static constexpr bool has_custom_constructor = has_from_flexbuf<T>::value;
 
+  Reader() : allow_borrowing_(true) {}
+
+  /// _allow_borrowing signals whether the underlying bytes outlive the
+  /// parsed value, which is required for std::string_view.
+  explicit Reader(const bool _allow_borrowing)
+      : allow_borrowing_(_allow_borrowing) {}
+
+  /// The name does not have to be null-terminated.
   rfl::Result<InputVarType> get_field(
-      const std::string& _name, const InputObjectType& _obj) const noexcept {
+      const std::string_view& _name,
+      const InputObjectType& _obj) const noexcept {
     const auto keys = _obj.Keys();
     for (size_t i = 0; i < keys.size(); ++i) {
-      if (_name == keys[i].AsString().c_str()) {
+      if (_name == keys[i].AsKey()) {
         return _obj.Values()[i];
       }
     }
-    return rfl::Error("Map does not contain any element called '" + _name +
-                      "'.");
+    return rfl::Error("Map does not contain any element called '" +
+                      std::string(_name) + "'.");
   }
 
   bool is_empty(const InputVarType& _var) const noexcept {
@@ -61,22 +74,34 @@ struct Reader {
   rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
     if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
       if (!_var.IsString()) {
-        return rfl::Error("Could not cast to string.");
+        return rfl::Error::from_static("Could not cast to string.");
       }
       return std::string(_var.AsString().c_str());
+    } else if constexpr (std::is_same<std::decay_t<T>, std::string_view>()) {
+      if (!allow_borrowing_) {
+        return rfl::Error(
+            "Fields of type std::string_view cannot be read from a stream "
+            "or loaded from a file, because they point into the underlying "
+            "bytes.");
+      }
+      if (!_var.IsString()) {
+        return rfl::Error::from_static("Could not cast to string.");
+      }
+      const auto str = _var.AsString();
+      return std::string_view(str.c_str(), str.length());
     } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
       if (!_var.IsBool()) {
-        return rfl::Error("Could not cast to boolean.");
+        return rfl::Error::from_static("Could not cast to boolean.");
       }
       return _var.AsBool();
     } else if constexpr (std::is_floating_point<std::decay_t<T>>()) {
       if (!_var.IsNumeric()) {
-        return rfl::Error("Could not cast to double.");
+        return rfl::Error::from_static("Could not cast to double.");
       }
       return static_cast<T>(_var.AsDouble());
     } else if constexpr (std::is_integral<std::decay_t<T>>()) {
       if (!_var.IsNumeric()) {
-        return rfl::Error("Could not cast to int.");
+        return rfl::Error::from_static("Could not cast to int.");
       }
       return static_cast<T>(_var.AsInt64());
     } else {
@@ -103,6 +128,18 @@ struct Reader {
     return f_arr;
   }
 
+  /// Returns a view of the string, which is valid for as long as the
+  /// underlying bytes. Unlike to_basic_type<std::string_view>(...), this is
+  /// only meant to be used while parsing, so it does not require borrowing.
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType& _var) const noexcept {
+    if (!_var.IsString()) {
+      return rfl::Error::from_static("Could not cast to string.");
+    }
+    const auto str = _var.AsString();
+    return std::string_view(str.c_str(), str.length());
+  }
+
   rfl::Result<InputArrayType> to_array(
       const InputVarType& _var) const noexcept {
     // Necessary, because we write empty vectors as null.
@@ -110,7 +147,7 @@ struct Reader {
       return flexbuffers::Vector::EmptyVector();
     }
     if (!_var.IsVector()) {
-      return rfl::Error("Could not cast to Vector.");
+      return rfl::Error::from_static("Could not cast to Vector.");
     }
     return _var.AsVector();
   }
@@ -131,6 +168,30 @@ struct Reader {
     return m;
   }
 
+  /// Calls _fct for each key-value pair of the map, until it returns an
+  /// error.
+  template <class FunctionType>
+  std::optional<Error> read_object(const FunctionType& _fct,
+                                   const InputObjectType& _obj) const noexcept {
+    const auto keys = _obj.Keys();
+    const auto values = _obj.Values();
+    const auto size = std::min(keys.size(), values.size());
+
+    for (size_t i = 0; i < size; ++i) {
+      const auto key = keys[i].AsString();
+      auto err = _fct(std::string_view(key.c_str(), key.length()), values[i]);
+      if (err) {
+        return err;
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// The number of key-value pairs in the map.
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return _obj.size();
+  }
+
   rfl::Result<InputObjectType> to_object(
       const InputVarType& _var) const noexcept {
     // Necessary, because we write empty maps as null.
@@ -138,7 +199,7 @@ struct Reader {
       return flexbuffers::Map::EmptyMap();
     }
     if (!_var.IsMap()) {
-      return rfl::Error("Could not cast to Map!");
+      return rfl::Error::from_static("Could not cast to Map!");
     }
     return _var.AsMap();
   }
@@ -152,6 +213,50 @@ struct Reader {
     return vec;
   }
 
+  /// Calls _fct for each element of the vector, until it returns an error.
+  template <class FunctionType>
+  std::optional<Error> read_array(const FunctionType& _fct,
+                                  const InputArrayType& _arr) const noexcept {
+    const auto size = _arr.size();
+    for (size_t i = 0; i < size; ++i) {
+      auto err = _fct(_arr[i]);
+      if (err) {
+        return err;
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// The number of elements in the vector.
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return _arr.size();
+  }
+
+  /// Reads a vector of numbers in a single pass. _get_buffer is called once
+  /// with the number of elements and returns the output iterator they are
+  /// written to.
+  /// Typed vectors whose elements have the same type and width as T are
+  /// copied directly from the underlying bytes. All other vectors are
+  /// converted element by element.
+  template <class T, class BufferFunctionType>
+  std::optional<Error> read_numbers(
+      const InputVarType& _var,
+      const BufferFunctionType& _get_buffer) const noexcept {
+    if (_var.IsTypedVector()) {
+      auto vec = _var.AsTypedVector();
+      const auto raw = RawTypedVector(vec);
+      if (has_layout_of<T>(vec.ElementType(), raw.byte_width())) {
+        return copy_elements<T>(raw, _get_buffer);
+      }
+      return read_elements<T>(vec, _get_buffer);
+    }
+    auto arr = to_array(_var);
+    if (!arr) {
+      return std::move(*arr.error());
+    }
+    return read_elements<T>(*arr, _get_buffer);
+  }
+
   template <class T>
   rfl::Result<T> use_custom_constructor(
       const InputVarType& _var) const noexcept {
@@ -161,6 +266,100 @@ struct Reader {
       return rfl::Error(e.what());
     }
   }
+
+ private:
+  /// Gives access to the bytes of a typed vector. They are protected
+  /// members of flexbuffers::TypedVector.
+  struct RawTypedVector : public flexbuffers::TypedVector {
+    explicit RawTypedVector(const flexbuffers::TypedVector& _vec)
+        : flexbuffers::TypedVector(_vec) {}
+
+    const uint8_t* data() const { return data_; }
+
+    uint8_t byte_width() const { return byte_width_; }
+  };
+
+  template <class T>
+  static Error cast_error() noexcept {
+    if constexpr (std::is_floating_point<T>()) {
+      return rfl::Error::from_static("Could not cast to double.");
+    } else {
+      return rfl::Error::from_static("Could not cast to int.");
+    }
+  }
+
+  /// Whether the elements of a typed vector are stored exactly like T.
+  /// flexbuffers always stores them in little endian.
+  template <class T>
+  static bool has_layout_of(const flexbuffers::Type _type,
+                            const uint8_t _byte_width) noexcept {
+    if constexpr (std::endian::native != std::endian::little) {
+      return false;
+    } else if constexpr (std::is_floating_point<T>()) {
+      return _type == flexbuffers::FBT_FLOAT && _byte_width == sizeof(T);
+    } else if constexpr (std::is_signed<T>()) {
+      return _type == flexbuffers::FBT_INT && _byte_width == sizeof(T);
+    } else {
+      return _type == flexbuffers::FBT_UINT && _byte_width == sizeof(T);
+    }
+  }
+
+  /// Copies the elements of a typed vector, which must have the layout of
+  /// T. The bytes are not necessarily aligned, so they are never accessed
+  /// through a T*.
+  template <class T, class BufferFunctionType>
+  static std::optional<Error> copy_elements(
+      const RawTypedVector& _vec,
+      const BufferFunctionType& _get_buffer) noexcept {
+    const auto size = _vec.size();
+    auto buffer = _get_buffer(size);
+    if (!buffer) {
+      return std::move(*buffer.error());
+    }
+    auto out = *buffer;
+    const auto data = _vec.data();
+    if constexpr (std::is_pointer_v<decltype(out)>) {
+      if (size != 0) {
+        std::memcpy(out, data, size * sizeof(T));
+      }
+    } else {
+      for (size_t i = 0; i < size; ++i) {
+        T val;
+        std::memcpy(&val, data + i * sizeof(T), sizeof(T));
+        *(out++) = val;
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// Converts the elements of a flexbuffers::Vector or
+  /// flexbuffers::TypedVector the same way to_basic_type<T>(...) does.
+  template <class T, class VectorType, class BufferFunctionType>
+  static std::optional<Error> read_elements(
+      const VectorType& _vec,
+      const BufferFunctionType& _get_buffer) noexcept {
+    const auto size = _vec.size();
+    auto buffer = _get_buffer(size);
+    if (!buffer) {
+      return std::move(*buffer.error());
+    }
+    auto out = *buffer;
+    for (size_t i = 0; i < size; ++i) {
+      const auto val = _vec[i];
+      if (!val.IsNumeric()) {
+        return cast_error<T>();
+      }
+      if constexpr (std::is_floating_point<T>()) {
+        *(out++) = static_cast<T>(val.AsDouble());
+      } else {
+        *(out++) = static_cast<T>(val.AsInt64());
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// Whether the underlying bytes outlive the parsed value.
+  bool allow_borrowing_;
 };
 
 }  // namespace flexbuf
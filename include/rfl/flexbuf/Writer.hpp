@@ -3,64 +3,178 @@
 
 #include <flatbuffers/flexbuffers.h>
 
-#include <exception>
-#include <functional>
-#include <map>
-#include <optional>
-#include <sstream>
-#include <stdexcept>
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <type_traits>
-#include <vector>
 
-#include "rfl/Ref.hpp"
 #include "rfl/Result.hpp"
-#include "rfl/flexbuf/OutputArray.hpp"
-#include "rfl/flexbuf/OutputNull.hpp"
-#include "rfl/flexbuf/OutputObject.hpp"
-#include "rfl/flexbuf/OutputValue.hpp"
-#include "rfl/flexbuf/OutputVar.hpp"
+#include "rfl/always_false.hpp"
 
 namespace rfl {
 namespace flexbuf {
 
+/// Drives the flexbuffers::Builder directly while the parsers traverse the
+/// objects, without building an intermediate tree first.
 struct Writer {
-  using OutputArrayType = Ref<OutputArray>;
-  using OutputObjectType = Ref<OutputObject>;
-  using OutputVarType = Ref<OutputVar>;
+  struct FlexbufOutputArray {
+    /// The value returned by StartVector().
+    size_t start_;
 
-  Writer() {}
+    /// Whether no element has been added to the vector yet.
+    bool empty_ = true;
+  };
+
+  struct FlexbufOutputObject {
+    /// The value returned by StartMap().
+    size_t start_;
+
+    /// Whether no field has been added to the map yet.
+    bool empty_ = true;
+  };
+
+  struct FlexbufOutputVar {};
+
+  using OutputArrayType = FlexbufOutputArray;
+  using OutputObjectType = FlexbufOutputObject;
+  using OutputVarType = FlexbufOutputVar;
+
+  Writer(flexbuffers::Builder* _fbb) : fbb_(_fbb) {}
 
   ~Writer() = default;
 
-  void add(const OutputVarType& _var, OutputArrayType* _arr) const noexcept {
-    (*_arr)->push_back(_var);
+  OutputArrayType array_as_root() const noexcept {
+    return OutputArrayType{fbb_->StartVector()};
+  }
+
+  OutputObjectType object_as_root() const noexcept {
+    return OutputObjectType{fbb_->StartMap()};
   }
 
-  OutputVarType empty_var() const noexcept { return Ref<OutputNull>::make(); }
+  OutputVarType null_as_root() const noexcept {
+    fbb_->Null();
+    return OutputVarType{};
+  }
 
   template <class T>
-  OutputVarType from_basic_type(const T& _var) const noexcept {
-    return Ref<OutputValue<T>>::make(_var);
+  OutputVarType value_as_root(const T& _var) const noexcept {
+    write_value(_var);
+    return OutputVarType{};
   }
 
-  OutputArrayType new_array() const noexcept {
-    return Ref<OutputArray>::make();
+  OutputArrayType add_array_to_array(OutputArrayType* _parent) const noexcept {
+    _parent->empty_ = false;
+    return OutputArrayType{fbb_->StartVector()};
   }
 
-  OutputObjectType new_object() const noexcept {
-    return Ref<OutputObject>::make();
+  OutputArrayType add_array_to_object(
+      const std::string_view& _name,
+      OutputObjectType* _parent) const noexcept {
+    start_field(_name, _parent);
+    return OutputArrayType{fbb_->StartVector()};
   }
 
-  bool is_empty(const OutputVarType& _var) const noexcept {
-    return _var->is_null();
+  OutputObjectType add_object_to_array(
+      OutputArrayType* _parent) const noexcept {
+    _parent->empty_ = false;
+    return OutputObjectType{fbb_->StartMap()};
   }
 
-  void set_field(const std::string& _name, const OutputVarType& _var,
-                 OutputObjectType* _obj) const noexcept {
-    (*_obj)->push_back(_name, _var);
+  OutputObjectType add_object_to_object(
+      const std::string_view& _name,
+      OutputObjectType* _parent) const noexcept {
+    start_field(_name, _parent);
+    return OutputObjectType{fbb_->StartMap()};
   }
+
+  template <class T>
+  OutputVarType add_value_to_array(const T& _var,
+                                   OutputArrayType* _parent) const noexcept {
+    _parent->empty_ = false;
+    write_value(_var);
+    return OutputVarType{};
+  }
+
+  template <class T>
+  OutputVarType add_value_to_object(const std::string_view& _name,
+                                    const T& _var,
+                                    OutputObjectType* _parent) const noexcept {
+    start_field(_name, _parent);
+    write_value(_var);
+    return OutputVarType{};
+  }
+
+  OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept {
+    _parent->empty_ = false;
+    fbb_->Null();
+    return OutputVarType{};
+  }
+
+  OutputVarType add_null_to_object(const std::string_view& _name,
+                                   OutputObjectType* _parent) const noexcept {
+    start_field(_name, _parent);
+    fbb_->Null();
+    return OutputVarType{};
+  }
+
+  /// We have to catch the edge case of an empty vector, because flexbuf
+  /// ignores empty vectors/maps. StartVector() does not modify the builder,
+  /// so we can simply write null instead.
+  void end_array(OutputArrayType* _arr) const noexcept {
+    if (_arr->empty_) {
+      fbb_->Null();
+    } else {
+      fbb_->EndVector(_arr->start_, false, false);
+    }
+  }
+
+  /// Same as above: Empty maps are written as null.
+  void end_object(OutputObjectType* _obj) const noexcept {
+    if (_obj->empty_) {
+      fbb_->Null();
+    } else {
+      fbb_->EndMap(_obj->start_);
+    }
+  }
+
+ private:
+  /// flexbuffers copies the terminating null character along with the key.
+  /// The names are either field names, which StringLiteral stores with a
+  /// null character, or map keys, which are std::string or NumberString, so
+  /// they can be passed on directly.
+  void start_field(const std::string_view& _name,
+                   OutputObjectType* _parent) const noexcept {
+    _parent->empty_ = false;
+    fbb_->Key(_name.data(), _name.size());
+  }
+
+  template <class T>
+  void write_value(const T& _var) const noexcept {
+    if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
+      fbb_->String(_var);
+    } else if constexpr (std::is_same<std::decay_t<T>, std::string_view>()) {
+      // Same as for the keys: The terminating null character is copied as
+      // well, but a view is not necessarily followed by one. So it is copied
+      // into a buffer that is reused for all views.
+      string_buffer_.assign(_var.data(), _var.size());
+      fbb_->String(string_buffer_);
+    } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
+      fbb_->Bool(_var);
+    } else if constexpr (std::is_floating_point<std::decay_t<T>>()) {
+      fbb_->Double(_var);
+    } else if constexpr (std::is_integral<std::decay_t<T>>()) {
+      fbb_->Int(_var);
+    } else {
+      static_assert(always_false_v<T>, "Unsupported type");
+    }
+  }
+
+ private:
+  /// The builder the values are written into.
+  flexbuffers::Builder* fbb_;
+
+  /// Holds std::string_view values while they are written.
+  mutable std::string string_buffer_;
 };
 
 }  // namespace flexbuf
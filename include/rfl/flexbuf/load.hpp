@@ -1,17 +1,30 @@
 #ifndef RFL_FLEXBUF_LOAD_HPP_
 #define RFL_FLEXBUF_LOAD_HPP_
 
+#include <cstdint>
+
 #include "rfl/Result.hpp"
 #include "rfl/flexbuf/read.hpp"
-#include "rfl/io/load_bytes.hpp"
+#include "rfl/io/MappedFile.hpp"
 
 namespace rfl {
 namespace flexbuf {
 
+/// Loads an object from a flexbuffers file. The file is mapped into memory
+/// and read in place, so the bytes are never copied. Strings are copied out
+/// of the mapping, because it is released once the object has been read.
 template <class T>
 Result<T> load(const std::string& _fname) {
-  const auto read_bytes = [](const auto& _bytes) { return read<T>(_bytes); };
-  return rfl::io::load_bytes(_fname).and_then(read_bytes);
+  const auto read_file = [&](const io::MappedFile& _file) -> Result<T> {
+    if (_file.size() == 0) {
+      return Error("File '" + _fname + "' is empty.");
+    }
+    const InputVarType root = flexbuffers::GetRoot(
+        reinterpret_cast<const uint8_t*>(_file.data()), _file.size());
+    const auto r = Reader(false);
+    return Parser<T>::read(r, root);
+  };
+  return io::MappedFile::open(_fname).and_then(read_file);
 }
 
 }  // namespace flexbuf
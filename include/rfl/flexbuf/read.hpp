@@ -8,6 +8,7 @@
 
 #include "rfl/Result.hpp"
 #include "rfl/flexbuf/Parser.hpp"
+#include "rfl/internal/stats/Timer.hpp"
 
 namespace rfl {
 namespace flexbuf {
@@ -26,6 +27,7 @@ template <class T>
 Result<T> read(const char* _bytes, const size_t _size) {
   const InputVarType root =
       flexbuffers::GetRoot(reinterpret_cast<const uint8_t*>(_bytes), _size);
+  internal::stats::record_bytes_read<T>(_size);
   return read<T>(root);
 }
 
@@ -40,7 +42,11 @@ template <class T>
 Result<T> read(std::istream& _stream) {
   std::istreambuf_iterator<char> begin(_stream), end;
   const auto bytes = std::vector<char>(begin, end);
-  return read<T>(bytes.data(), bytes.size());
+  const InputVarType root = flexbuffers::GetRoot(
+      reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+  internal::stats::record_bytes_read<T>(bytes.size());
+  const auto r = Reader(false);
+  return Parser<T>::read(r, root);
 }
 
 }  // namespace flexbuf
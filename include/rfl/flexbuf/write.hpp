@@ -4,29 +4,43 @@
 #include <flatbuffers/flexbuffers.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <ostream>
-#include <sstream>
 #include <vector>
 
 #include "rfl/flexbuf/Parser.hpp"
+#include "rfl/internal/stats/Timer.hpp"
+#include "rfl/parsing/Parent.hpp"
 
 namespace rfl {
 namespace flexbuf {
 
+/// Writes an object into an existing builder, which is cleared first. The
+/// result can be accessed using _fbb->GetBuffer() without copying it, and the
+/// builder can be reused to avoid allocating a new buffer for every object.
+template <class T>
+void write(const T& _obj, flexbuffers::Builder* _fbb) {
+  using ParentType = parsing::Parent<Writer>;
+  _fbb->Clear();
+  const auto w = Writer(_fbb);
+  Parser<T>::write(w, _obj, typename ParentType::Root{});
+  _fbb->Finish();
+  internal::stats::record_bytes_written<T>(_fbb->GetBuffer().size());
+}
+
 template <class T>
 std::vector<uint8_t> to_buffer(const T& _obj) {
-  auto w = Writer();
-  const auto flexbuf_obj = Parser<T>::write(w, _obj);
   flexbuffers::Builder fbb;
-  flexbuf_obj->insert(std::nullopt, &fbb);
-  fbb.Finish();
+  write(_obj, &fbb);
   return fbb.GetBuffer();
 }
 
 /// Writes an object to flexbuf.
 template <class T>
 std::vector<char> write(const T& _obj) {
-  const auto buffer = to_buffer(_obj);
+  flexbuffers::Builder fbb;
+  write(_obj, &fbb);
+  const auto& buffer = fbb.GetBuffer();
   const auto data = reinterpret_cast<const char*>(buffer.data());
   return std::vector<char>(data, data + buffer.size());
 }
@@ -34,7 +48,9 @@ std::vector<char> write(const T& _obj) {
 /// Writes an object to an ostream.
 template <class T>
 std::ostream& write(const T& _obj, std::ostream& _stream) {
-  const auto buffer = to_buffer(_obj);
+  flexbuffers::Builder fbb;
+  write(_obj, &fbb);
+  const auto& buffer = fbb.GetBuffer();
   const auto data = reinterpret_cast<const char*>(buffer.data());
   _stream.write(data, buffer.size());
   return _stream;
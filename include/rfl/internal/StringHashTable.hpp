@@ -0,0 +1,114 @@
+#ifndef RFL_INTERNAL_STRINGHASHTABLE_HPP_
+#define RFL_INTERNAL_STRINGHASHTABLE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace rfl {
+namespace internal {
+
+/// Maps a fixed set of strings to their position within that set. The table
+/// is built entirely at compile time (open addressing with the hash seed
+/// chosen to minimize the probe lengths), so there is no static
+/// initialization at run time and a lookup usually costs a single hash plus
+/// a single string comparison.
+template <size_t _n>
+class StringHashTable {
+  /// A power of two that is at least twice the number of keys, so there
+  /// always is at least one empty slot and the probe sequences stay short.
+  static constexpr size_t num_slots_ = [] {
+    size_t n = 1;
+    while (n < 2 * _n) {
+      n *= 2;
+    }
+    return n;
+  }();
+
+  /// The number of seeds we try before settling for the best one found.
+  static constexpr std::uint64_t max_seeds_ = 32;
+
+ public:
+  consteval StringHashTable(const std::array<std::string_view, _n>& _keys)
+      : keys_(_keys), seed_(0), slots_{} {
+    auto best_cost = static_cast<size_t>(-1);
+    for (std::uint64_t seed = 0; seed < max_seeds_ && best_cost != 0;
+         ++seed) {
+      const auto cost = fill_slots(seed);
+      if (cost < best_cost) {
+        best_cost = cost;
+        seed_ = seed;
+      }
+    }
+    fill_slots(seed_);
+  }
+
+  /// Returns the position of _str within the original keys or -1, if _str is
+  /// not one of the keys. If a key occurs more than once, the last position
+  /// is returned.
+  constexpr int find(const std::string_view& _str) const noexcept {
+    auto slot = hash(_str, seed_) & (num_slots_ - 1);
+    while (true) {
+      const auto ix = slots_[slot];
+      if (ix == -1 || keys_[ix] == _str) {
+        return ix;
+      }
+      slot = (slot + 1) & (num_slots_ - 1);
+    }
+  }
+
+  /// The keys, in their original order.
+  constexpr const std::array<std::string_view, _n>& keys() const noexcept {
+    return keys_;
+  }
+
+  /// The number of keys.
+  static constexpr size_t size() noexcept { return _n; }
+
+ private:
+  /// FNV-1a, mixed with a seed.
+  static constexpr size_t hash(const std::string_view& _str,
+                               const std::uint64_t _seed) noexcept {
+    auto h = static_cast<std::uint64_t>(14695981039346656037ULL) ^
+             (_seed * static_cast<std::uint64_t>(0x9E3779B97F4A7C15ULL));
+    for (const char c : _str) {
+      h ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+      h *= static_cast<std::uint64_t>(1099511628211ULL);
+    }
+    return static_cast<size_t>(h ^ (h >> 32));
+  }
+
+  /// Inserts all keys using the seed and returns the total number of
+  /// additional probes required to find them.
+  constexpr size_t fill_slots(const std::uint64_t _seed) noexcept {
+    for (auto& s : slots_) {
+      s = -1;
+    }
+    size_t cost = 0;
+    for (size_t i = 0; i < _n; ++i) {
+      auto slot = hash(keys_[i], _seed) & (num_slots_ - 1);
+      while (slots_[slot] != -1 && keys_[slots_[slot]] != keys_[i]) {
+        slot = (slot + 1) & (num_slots_ - 1);
+        ++cost;
+      }
+      slots_[slot] = static_cast<std::int32_t>(i);
+    }
+    return cost;
+  }
+
+ private:
+  /// The keys, in their original order.
+  std::array<std::string_view, _n> keys_;
+
+  /// The seed used for hashing.
+  std::uint64_t seed_;
+
+  /// Contains the position of the key or -1 for empty slots.
+  std::array<std::int32_t, num_slots_> slots_;
+};
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -12,11 +12,14 @@ namespace internal {
 /// Normal strings cannot be used as template
 /// parameters, but this can. This is needed
 /// for the parameters names in the NamedTuples.
+/// The string is followed by a null character, which is not part of
+/// string_view(), so string_view().data() can also be passed to functions
+/// expecting a null-terminated string.
 template <size_t N>
 struct StringLiteral {
   constexpr StringLiteral(const auto... _chars) : arr_{_chars...} {}
 
-  constexpr StringLiteral(const char (&_str)[N]) {
+  constexpr StringLiteral(const char (&_str)[N]) : arr_{} {
     std::copy_n(_str, N - 1, std::data(arr_));
   }
 
@@ -28,7 +31,7 @@ struct StringLiteral {
     return std::string_view(std::data(arr_), N - 1);
   }
 
-  std::array<char, N - 1> arr_;
+  std::array<char, N> arr_;
 };
 
 template <size_t N1, size_t N2>
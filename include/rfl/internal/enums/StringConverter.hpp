@@ -1,17 +1,21 @@
 #ifndef RFL_INTERNAL_ENUMS_STRINGCONVERTER_HPP_
 #define RFL_INTERNAL_ENUMS_STRINGCONVERTER_HPP_
 
-#include <algorithm>
 #include <array>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
+#include <utility>
 
 #include "rfl/Result.hpp"
 #include "rfl/internal/enums/get_enum_names.hpp"
 #include "rfl/internal/enums/is_flag_enum.hpp"
-#include "rfl/internal/strings/join.hpp"
-#include "rfl/internal/strings/split.hpp"
 #include "rfl/type_name_t.hpp"
 
 namespace rfl {
@@ -21,6 +25,8 @@ namespace enums {
 template <class EnumType>
 class StringConverter {
  private:
+  using T = std::underlying_type_t<EnumType>;
+
   static constexpr bool is_flag_enum_ = is_flag_enum<EnumType>;
 
   static constexpr auto names_ = get_enum_names<EnumType, is_flag_enum_>();
@@ -37,8 +43,19 @@ class StringConverter {
     }
   }
 
+  /// Returns the name of the enum without copying it, if the enum exactly
+  /// matches one of the names, and std::nullopt otherwise.
+  static std::optional<std::string_view> enum_to_string_view(
+      const EnumType _enum) noexcept {
+    const auto slot = get_slot(static_cast<T>(_enum));
+    if (slot < 0 || slots_[slot] == -1) {
+      return std::nullopt;
+    }
+    return NamesLiteral::names()[slots_[slot]];
+  }
+
   /// Transforms a string to the matching enum.
-  static Result<EnumType> string_to_enum(const std::string& _str) {
+  static Result<EnumType> string_to_enum(const std::string_view& _str) {
     static_assert(names_.size != 0,
                   "No enum could be identified. Please choose enum values "
                   "between 0 to 127 or for flag enums choose 1,2,4,8,16,...");
@@ -50,78 +67,108 @@ class StringConverter {
   }
 
  private:
+  /// The enums can only assume the values 0 to 127 or, for flag enums,
+  /// powers of two, so every possible value has a slot in a small array.
+  static constexpr size_t num_slots_ =
+      is_flag_enum_ ? sizeof(T) * 8
+                    : static_cast<size_t>(get_max<T, false>()) + 1;
+
+  /// Returns the slot of the value or -1, if the value cannot have a name.
+  static constexpr int get_slot(const T _val) noexcept {
+    if constexpr (is_flag_enum_) {
+      using U = std::make_unsigned_t<T>;
+      const auto u = static_cast<U>(_val);
+      if (u == 0 || (u & (u - 1)) != 0) {
+        return -1;
+      }
+      return std::countr_zero(u);
+    } else {
+      if (std::cmp_less(_val, 0) || std::cmp_greater_equal(_val, num_slots_)) {
+        return -1;
+      }
+      return static_cast<int>(_val);
+    }
+  }
+
+  /// Maps each slot to the position of the name in the literal or -1, if
+  /// there is no such name. This is generated at compile time.
+  static constexpr std::array<std::int16_t, num_slots_> slots_ = [] {
+    std::array<std::int16_t, num_slots_> slots;
+    slots.fill(-1);
+    for (size_t i = 0; i < names_.size; ++i) {
+      slots[get_slot(static_cast<T>(names_.enums_[i]))] =
+          static_cast<std::int16_t>(i);
+    }
+    return slots;
+  }();
+
   /// Iterates through the enum bit by bit and matches it against the flags.
   static std::string flag_enum_to_string(const EnumType _e) {
-    using T = std::underlying_type_t<EnumType>;
-    auto val = static_cast<T>(_e);
-    int i = 0;
-    std::vector<std::string> flags;
-    while (val != 0) {
-      const auto bit = val & static_cast<T>(1);
-      if (bit == 1) {
-        auto str = enum_to_single_string(
-            static_cast<EnumType>(static_cast<T>(1) << i));
-        flags.emplace_back(std::move(str));
+    using U = std::make_unsigned_t<T>;
+    auto val = static_cast<U>(_e);
+    std::string str;
+    for (int i = 0; val != 0; ++i, val >>= 1) {
+      if ((val & static_cast<U>(1)) == 0) {
+        continue;
+      }
+      if (str.size() != 0) {
+        str += '|';
+      }
+      if (slots_[i] != -1) {
+        str += NamesLiteral::names()[slots_[i]];
+      } else {
+        str += std::to_string(static_cast<T>(static_cast<U>(1) << i));
       }
-      ++i;
-      val >>= 1;
     }
-    return strings::join("|", flags);
+    return str;
   }
 
   /// This assumes that _enum can be exactly matched to one of the names and
   /// does not have to be combined using |.
   static std::string enum_to_single_string(const EnumType _enum) {
-    const auto to_str = [](const auto _l) { return _l.str(); };
-
-    for (size_t i = 0; i < names_.size; ++i) {
-      if (names_.enums_[i] == _enum) {
-        return NamesLiteral::from_value(
-                   static_cast<typename NamesLiteral::ValueType>(i))
-            .transform(to_str)
-            .value();
-      }
+    const auto name = enum_to_string_view(_enum);
+    if (name) {
+      return std::string(*name);
     }
-
-    return std::to_string(static_cast<std::underlying_type_t<EnumType>>(_enum));
-  }
-
-  /// Finds the enum matching the literal.
-  static EnumType literal_to_enum(const NamesLiteral _lit) noexcept {
-    return names_.enums_[_lit.value()];
+    return std::to_string(static_cast<T>(_enum));
   }
 
   /// This assumes that _enum can be exactly matched to one of the names and
-  /// does not have to be combined using |.
-  static Result<EnumType> single_string_to_enum(const std::string& _str) {
-    const auto r = NamesLiteral::from_string(_str).transform(literal_to_enum);
-    if (r) {
-      return r;
-    } else {
-      try {
-        return static_cast<EnumType>(std::stoi(_str));
-      } catch (std::exception& exp) {
-        return Error(exp.what());
-      }
+  /// does not have to be combined using |. If it cannot be matched, _str is
+  /// interpreted as the underlying value.
+  static Result<EnumType> single_string_to_enum(const std::string_view& _str) {
+    const auto ix = NamesLiteral::index_of(_str);
+    if (ix != -1) {
+      return names_.enums_[ix];
     }
+    T val = 0;
+    const auto end = _str.data() + _str.size();
+    const auto [ptr, ec] = std::from_chars(_str.data(), end, val);
+    if (ec != std::errc() || ptr != end) {
+      return Error("Could not parse enum: '" + std::string(_str) +
+                   "' is neither one of its names nor an integer.");
+    }
+    return static_cast<EnumType>(val);
   }
 
   /// Only relevant if this is a flag enum - combines the different matches
   /// using |.
   static Result<EnumType> string_to_flag_enum(
-      const std::string& _str) noexcept {
-    using T = std::underlying_type_t<EnumType>;
-    const auto split = strings::split(_str, "|");
+      const std::string_view& _str) noexcept {
     auto res = static_cast<T>(0);
-    for (const auto& s : split) {
-      const auto r = single_string_to_enum(s);
-      if (r) {
-        res |= static_cast<T>(*r);
-      } else {
+    size_t begin = 0;
+    while (true) {
+      const auto end = _str.find('|', begin);
+      const auto r = single_string_to_enum(_str.substr(begin, end - begin));
+      if (!r) {
         return r;
       }
+      res |= static_cast<T>(*r);
+      if (end == std::string_view::npos) {
+        return static_cast<EnumType>(res);
+      }
+      begin = end + 1;
     }
-    return static_cast<EnumType>(res);
   }
 };
 
@@ -0,0 +1,86 @@
+#ifndef RFL_INTERNAL_STATS_COUNTERS_HPP_
+#define RFL_INTERNAL_STATS_COUNTERS_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "rfl/internal/get_type_name.hpp"
+
+namespace rfl {
+namespace internal {
+namespace stats {
+
+enum class Operation { read, write };
+
+/// The counters for a single type. All of them are cumulative, meaning that
+/// the time and the allocations spent on nested types are included.
+struct Counters {
+  std::atomic<size_t> num_reads_ = 0;
+  std::atomic<size_t> num_writes_ = 0;
+  std::atomic<size_t> bytes_read_ = 0;
+  std::atomic<size_t> bytes_written_ = 0;
+  std::atomic<size_t> allocations_ = 0;
+  std::atomic<std::int64_t> read_ns_ = 0;
+  std::atomic<std::int64_t> write_ns_ = 0;
+};
+
+/// Keeps track of the counters of all types that have been read or written
+/// so far. Every type is registered exactly once, so the mutex is not
+/// involved in the actual counting.
+class Registry {
+ public:
+  static Registry& instance() {
+    static Registry registry;
+    return registry;
+  }
+
+  void add(const std::string_view _type_name, Counters* _counters) {
+    const auto lock = std::lock_guard<std::mutex>(mtx_);
+    entries_.emplace_back(_type_name, _counters);
+  }
+
+  template <class F>
+  void for_each(const F& _f) const {
+    const auto lock = std::lock_guard<std::mutex>(mtx_);
+    for (const auto& [type_name, counters] : entries_) {
+      _f(type_name, counters);
+    }
+  }
+
+ private:
+  mutable std::mutex mtx_;
+  std::vector<std::pair<std::string_view, Counters*>> entries_;
+};
+
+template <class T>
+inline constexpr auto type_name_v = get_type_name<T>();
+
+/// Returns the counters for type T, registering them on first use.
+template <class T>
+Counters& counters_for() {
+  static Counters counters;
+  static const bool registered = []() {
+    Registry::instance().add(type_name_v<T>.string_view(), &counters);
+    return true;
+  }();
+  (void)registered;
+  return counters;
+}
+
+/// The number of allocations on this thread, as reported through
+/// rfl::stats::record_allocation().
+inline size_t& thread_allocations() noexcept {
+  thread_local size_t num_allocations = 0;
+  return num_allocations;
+}
+
+}  // namespace stats
+}  // namespace internal
+}  // namespace rfl
+
+#endif
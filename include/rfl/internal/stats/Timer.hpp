@@ -0,0 +1,92 @@
+#ifndef RFL_INTERNAL_STATS_TIMER_HPP_
+#define RFL_INTERNAL_STATS_TIMER_HPP_
+
+#include <chrono>
+#include <cstddef>
+
+#include "rfl/internal/stats/Counters.hpp"
+
+namespace rfl {
+namespace internal {
+namespace stats {
+
+// REFLECTCPP_STATS changes the definitions of the parsers, so it must be
+// defined for either all translation units or none, see docs/stats.md.
+#ifdef REFLECTCPP_STATS
+
+/// Counts a read or write of type T and the time and allocations spent on it
+/// for as long as it is alive.
+template <class T, Operation _op>
+class Timer {
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  Timer() noexcept
+      : allocations_(thread_allocations()), begin_(Clock::now()) {}
+
+  Timer(const Timer&) = delete;
+
+  ~Timer() {
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        Clock::now() - begin_)
+                        .count();
+    auto& counters = counters_for<T>();
+    if constexpr (_op == Operation::read) {
+      counters.num_reads_.fetch_add(1, std::memory_order_relaxed);
+      counters.read_ns_.fetch_add(ns, std::memory_order_relaxed);
+    } else {
+      counters.num_writes_.fetch_add(1, std::memory_order_relaxed);
+      counters.write_ns_.fetch_add(ns, std::memory_order_relaxed);
+    }
+    counters.allocations_.fetch_add(thread_allocations() - allocations_,
+                                    std::memory_order_relaxed);
+  }
+
+ private:
+  const size_t allocations_;
+  const Clock::time_point begin_;
+};
+
+/// Records the size of the input T has been read from.
+template <class T>
+void record_bytes_read(const size_t _bytes) noexcept {
+  counters_for<T>().bytes_read_.fetch_add(_bytes, std::memory_order_relaxed);
+}
+
+/// Records the size of the output T has been written into.
+template <class T>
+void record_bytes_written(const size_t _bytes) noexcept {
+  counters_for<T>().bytes_written_.fetch_add(_bytes,
+                                             std::memory_order_relaxed);
+}
+
+#else
+
+/// Without REFLECTCPP_STATS, the instrumentation is compiled out entirely.
+template <class T, Operation _op>
+class Timer {
+ public:
+  Timer() noexcept {}
+
+  ~Timer() {}
+};
+
+template <class T>
+void record_bytes_read(const size_t) noexcept {}
+
+template <class T>
+void record_bytes_written(const size_t) noexcept {}
+
+#endif
+
+template <class T>
+using ReadTimer = Timer<T, Operation::read>;
+
+template <class T>
+using WriteTimer = Timer<T, Operation::write>;
+
+}  // namespace stats
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef RFL_INTERNAL_STRINGS_NUMBERSTRING_HPP_
+#define RFL_INTERNAL_STRINGS_NUMBERSTRING_HPP_
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace rfl {
+namespace internal {
+namespace strings {
+
+/// Formats a number into a buffer on the stack. Floating point numbers are
+/// written using the shortest representation that reads back to the same
+/// value, unlike std::to_string(...), which always uses six decimals.
+class NumberString {
+ public:
+  template <class T>
+  explicit NumberString(const T _val) noexcept {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                  "Only numbers can be formatted.");
+    const auto res = std::to_chars(buf_, buf_ + sizeof(buf_) - 1, _val);
+    size_ = static_cast<size_t>(res.ptr - buf_);
+    buf_[size_] = '\0';
+  }
+
+  /// The formatted number, as a null-terminated string.
+  const char* c_str() const noexcept { return buf_; }
+
+  /// The formatted number as a std::string.
+  std::string str() const { return std::string(buf_, size_); }
+
+  /// The formatted number as a std::string_view, which is valid for as long
+  /// as this object.
+  std::string_view view() const noexcept {
+    return std::string_view(buf_, size_);
+  }
+
+ private:
+  /// Large enough for any integer and for the shortest representation of
+  /// any floating point number, including long double.
+  char buf_[48];
+
+  /// The number of characters written.
+  size_t size_;
+};
+
+}  // namespace strings
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef RFL_INTERNAL_STRINGS_FROM_CHARS_HPP_
+#define RFL_INTERNAL_STRINGS_FROM_CHARS_HPP_
+
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace rfl {
+namespace internal {
+namespace strings {
+
+/// libc++ only supports std::from_chars for floating point numbers since
+/// version 20. The supported versions of GCC and MSVC always do.
+#if defined(_LIBCPP_VERSION) && _LIBCPP_VERSION < 200000
+inline constexpr bool has_floating_point_from_chars = false;
+#else
+inline constexpr bool has_floating_point_from_chars = true;
+#endif
+
+/// Falls back to std::strtod(...) and its siblings, but accepts exactly what
+/// std::from_chars(...) accepts: No leading whitespace, no '+' and no
+/// hexadecimal numbers. Unlike std::from_chars(...), the decimal point
+/// depends on the C locale.
+template <class T>
+std::from_chars_result floating_point_from_chars(const char* _begin,
+                                                 const char* _end,
+                                                 T& _value) {
+  const auto digits = _begin != _end && *_begin == '-' ? _begin + 1 : _begin;
+  if (digits == _end || std::isspace(static_cast<unsigned char>(*digits)) ||
+      *digits == '+' || *digits == '-') {
+    return {_begin, std::errc::invalid_argument};
+  }
+
+  // std::from_chars(...) reads "0x10" as 0 followed by "x10".
+  if (_end - digits > 1 && digits[0] == '0' &&
+      (digits[1] == 'x' || digits[1] == 'X')) {
+    _value = digits == _begin ? T(0) : -T(0);
+    return {digits + 1, std::errc()};
+  }
+
+  // The range is not necessarily null-terminated.
+  const auto str = std::string(_begin, _end);
+  char* ptr = nullptr;
+  errno = 0;
+  T value;
+  if constexpr (std::is_same<T, float>()) {
+    value = std::strtof(str.c_str(), &ptr);
+  } else if constexpr (std::is_same<T, double>()) {
+    value = std::strtod(str.c_str(), &ptr);
+  } else {
+    value = std::strtold(str.c_str(), &ptr);
+  }
+  const auto parsed = ptr - str.c_str();
+  if (parsed == 0) {
+    return {_begin, std::errc::invalid_argument};
+  }
+  if (errno == ERANGE && (std::isinf(value) || value == 0)) {
+    return {_begin + parsed, std::errc::result_out_of_range};
+  }
+  _value = value;
+  return {_begin + parsed, std::errc()};
+}
+
+/// Like std::from_chars(...), but also works for floating point numbers on
+/// standard libraries that do not support them yet.
+template <class T>
+std::from_chars_result from_chars(const char* _begin, const char* _end,
+                                  T& _value) {
+  if constexpr (std::is_floating_point<T>() &&
+                !has_floating_point_from_chars) {
+    return floating_point_from_chars(_begin, _end, _value);
+  } else {
+    return std::from_chars(_begin, _end, _value);
+  }
+}
+
+}  // namespace strings
+}  // namespace internal
+}  // namespace rfl
+
+#endif
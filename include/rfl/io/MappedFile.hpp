@@ -0,0 +1,156 @@
+#ifndef RFL_IO_MAPPEDFILE_HPP_
+#define RFL_IO_MAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "rfl/Result.hpp"
+#include "rfl/io/read_all.hpp"
+
+namespace rfl {
+namespace io {
+
+/// A file that has been mapped into memory read-only. The content is paged
+/// in by the operating system on demand, so the file is never copied. The
+/// mapping is released, when the MappedFile is destroyed, which invalidates
+/// all pointers into it.
+///
+/// Only regular files with a known size are mapped. Everything else, like
+/// pipes or the files in procfs, is read into memory instead. So are all
+/// files on Windows, which keeps <windows.h> out of this header.
+class MappedFile {
+ public:
+  MappedFile(const MappedFile& _other) = delete;
+
+  MappedFile(MappedFile&& _other) noexcept
+      : buffer_(std::move(_other.buffer_)),
+        data_(std::exchange(_other.data_, nullptr)),
+        is_mapped_(std::exchange(_other.is_mapped_, false)),
+        size_(std::exchange(_other.size_, 0)) {}
+
+  ~MappedFile() { unmap(); }
+
+  /// Maps the file into memory.
+  static Result<MappedFile> open(const std::string& _fname) noexcept {
+#ifdef _WIN32
+    return read(_fname);
+#else
+    const int fd = ::open(_fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return open_error(_fname);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      ::close(fd);
+      return open_error(_fname);
+    }
+    const auto size = static_cast<size_t>(st.st_size);
+    if (!S_ISREG(st.st_mode) || size == 0) {
+      ::close(fd);
+      return read(_fname);
+    }
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+      return map_error(_fname);
+    }
+    return MappedFile(static_cast<const char*>(data), size);
+#endif
+  }
+
+  /// The beginning of the file's content.
+  const char* data() const noexcept { return data_ ? data_ : ""; }
+
+  /// The size of the file in bytes.
+  size_t size() const noexcept { return size_; }
+
+  MappedFile& operator=(const MappedFile& _other) = delete;
+
+  MappedFile& operator=(MappedFile&& _other) noexcept {
+    if (this != &_other) {
+      unmap();
+      buffer_ = std::move(_other.buffer_);
+      data_ = std::exchange(_other.data_, nullptr);
+      is_mapped_ = std::exchange(_other.is_mapped_, false);
+      size_ = std::exchange(_other.size_, 0);
+    }
+    return *this;
+  }
+
+ private:
+  MappedFile(const char* _data, const size_t _size)
+      : data_(_data), is_mapped_(true), size_(_size) {}
+
+  explicit MappedFile(std::vector<char>&& _buffer)
+      : buffer_(std::move(_buffer)),
+        data_(buffer_.empty() ? nullptr : buffer_.data()),
+        is_mapped_(false),
+        size_(buffer_.size()) {}
+
+  static Error open_error(const std::string& _fname) {
+    return Error("Unable to open file '" + _fname +
+                 "' or file could not be found.");
+  }
+
+  static Error map_error(const std::string& _fname) {
+    return Error("Could not map file '" + _fname + "' into memory.");
+  }
+
+  /// Reads files that cannot be mapped into memory.
+  static Result<MappedFile> read(const std::string& _fname) noexcept {
+    try {
+      std::ifstream input(_fname, std::ios::binary);
+      if (!input.is_open()) {
+        return open_error(_fname);
+      }
+      auto bytes = read_all<std::vector<char>>(&input, _fname);
+      if (!bytes) {
+        return std::move(*bytes.error());
+      }
+      return MappedFile(std::move(*bytes));
+    } catch (std::exception& e) {
+      return Error(e.what());
+    }
+  }
+
+  void unmap() noexcept {
+#ifndef _WIN32
+    if (is_mapped_) {
+      munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+    buffer_.clear();
+    data_ = nullptr;
+    is_mapped_ = false;
+    size_ = 0;
+  }
+
+ private:
+  /// The content of files that are read instead of being mapped.
+  std::vector<char> buffer_;
+
+  /// The beginning of the content or nullptr, if the file is empty.
+  const char* data_;
+
+  /// Whether data_ points to a mapping rather than into buffer_.
+  bool is_mapped_;
+
+  /// The size of the content.
+  size_t size_;
+};
+
+}  // namespace io
+}  // namespace rfl
+
+#endif
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "rfl/Result.hpp"
+#include "rfl/io/read_all.hpp"
 
 namespace rfl {
 namespace io {
@@ -14,10 +15,7 @@ namespace io {
 inline Result<std::vector<char>> load_bytes(const std::string& _fname) {
   std::ifstream input(_fname, std::ios::binary);
   if (input.is_open()) {
-    std::istreambuf_iterator<char> begin(input), end;
-    const auto bytes = std::vector<char>(begin, end);
-    input.close();
-    return bytes;
+    return read_all<std::vector<char>>(&input, _fname);
   } else {
     return rfl::Error("File '" + _fname + "' not found!");
   }
@@ -6,6 +6,7 @@
 #include <string>
 
 #include "rfl/Result.hpp"
+#include "rfl/io/read_all.hpp"
 
 namespace rfl {
 namespace io {
@@ -13,10 +14,7 @@ namespace io {
 inline Result<std::string> load_string(const std::string& _fname) {
   std::ifstream infile(_fname);
   if (infile.is_open()) {
-    auto r = std::string(std::istreambuf_iterator<char>(infile),
-                         std::istreambuf_iterator<char>());
-    infile.close();
-    return r;
+    return read_all<std::string>(&infile, _fname);
   } else {
     return Error("Unable to open file '" + _fname +
                  "' or file could not be found.");
@@ -0,0 +1,48 @@
+#ifndef RFL_IO_READ_ALL_HPP_
+#define RFL_IO_READ_ALL_HPP_
+
+#include <cstddef>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <string>
+
+#include "rfl/Result.hpp"
+
+namespace rfl {
+namespace io {
+
+/// Reads the entire content of a file that has just been opened. Reading it
+/// in a single call is much faster than going through
+/// std::istreambuf_iterator, but that requires the size of the file. Inputs
+/// that cannot seek, like pipes, or that report a size of zero, like the
+/// files in procfs, are read through the iterators instead. In text mode,
+/// fewer characters than bytes may be read, so the container is shrunk
+/// afterwards.
+template <class ContainerType>
+Result<ContainerType> read_all(std::istream* _input,
+                               const std::string& _fname) {
+  ContainerType content;
+  _input->seekg(0, std::ios::end);
+  const auto size = static_cast<std::streamoff>(_input->tellg());
+  _input->clear();
+  if (size > 0) {
+    _input->seekg(0, std::ios::beg);
+    content.resize(static_cast<size_t>(size));
+    _input->read(content.data(), static_cast<std::streamsize>(size));
+    content.resize(static_cast<size_t>(_input->gcount()));
+  }
+  if (_input->good()) {
+    content.insert(content.end(), std::istreambuf_iterator<char>(*_input),
+                   std::istreambuf_iterator<char>());
+  }
+  if (_input->bad()) {
+    return Error("Could not read file '" + _fname + "'.");
+  }
+  return content;
+}
+
+}  // namespace io
+}  // namespace rfl
+
+#endif
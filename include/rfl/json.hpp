@@ -1,12 +1,18 @@
 #ifndef RFL_JSON_HPP_
 #define RFL_JSON_HPP_
 
+#include "rfl/json/Borrowed.hpp"
 #include "rfl/json/Parser.hpp"
+#include "rfl/json/ReadOptions.hpp"
 #include "rfl/json/Reader.hpp"
+#include "rfl/json/StreamReader.hpp"
+#include "rfl/json/StreamWriter.hpp"
 #include "rfl/json/Writer.hpp"
 #include "rfl/json/load.hpp"
 #include "rfl/json/read.hpp"
+#include "rfl/json/read_stream.hpp"
 #include "rfl/json/save.hpp"
 #include "rfl/json/write.hpp"
+#include "rfl/json/write_stream.hpp"
 
 #endif
@@ -0,0 +1,66 @@
+#ifndef RFL_JSON_BORROWED_HPP_
+#define RFL_JSON_BORROWED_HPP_
+
+#include <yyjson.h>
+
+#include <memory>
+#include <utility>
+
+namespace rfl {
+namespace json {
+
+/// Contains a value read by rfl::json::read_borrowed(...) together with the
+/// yyjson document it has been read from. Fields of type std::string_view
+/// point directly into that document, so they remain valid for exactly as
+/// long as the Borrowed object itself. Moving a Borrowed object does not
+/// invalidate them.
+template <class T>
+class Borrowed {
+ public:
+  using DocPtrType = std::unique_ptr<yyjson_doc, void (*)(yyjson_doc*)>;
+
+  Borrowed(DocPtrType&& _doc, T&& _value)
+      : doc_(std::move(_doc)), value_(std::move(_value)) {}
+
+  Borrowed(const Borrowed<T>& _other) = delete;
+
+  Borrowed(Borrowed<T>&& _other) noexcept = default;
+
+  ~Borrowed() = default;
+
+  /// Returns the underlying value.
+  T& value() { return value_; }
+
+  /// Returns the underlying value.
+  const T& value() const { return value_; }
+
+  /// Returns the underlying value.
+  T& operator*() { return value_; }
+
+  /// Returns the underlying value.
+  const T& operator*() const { return value_; }
+
+  /// Returns a pointer to the underlying value.
+  T* operator->() { return &value_; }
+
+  /// Returns a pointer to the underlying value.
+  const T* operator->() const { return &value_; }
+
+  /// Borrowed objects cannot be copied, because they own the document.
+  Borrowed<T>& operator=(const Borrowed<T>& _other) = delete;
+
+  /// Move assignment operator.
+  Borrowed<T>& operator=(Borrowed<T>&& _other) noexcept = default;
+
+ private:
+  /// The document the value has been read from.
+  DocPtrType doc_;
+
+  /// The value, which may contain views into doc_.
+  T value_;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef RFL_JSON_READOPTIONS_HPP_
+#define RFL_JSON_READOPTIONS_HPP_
+
+#include <yyjson.h>
+
+namespace rfl {
+namespace json {
+
+/// Options for rfl::json::read(...). The flags and the allocator are passed
+/// on to yyjson_read_opts(...). They contain no state of their own, so the
+/// same options can be reused for any number of calls.
+struct ReadOptions {
+  /// Flags such as YYJSON_READ_INSITU or YYJSON_READ_ALLOW_COMMENTS.
+  yyjson_read_flag flags = YYJSON_READ_NOFLAG;
+
+  /// The allocator used for the document, for instance one that has been
+  /// initialized using yyjson_alc_pool_init(...). nullptr means that the
+  /// default allocator (malloc/free) is used.
+  const yyjson_alc* alc = nullptr;
+
+  /// By default, all fields of an object are parsed even after one of them
+  /// has failed, so that all errors can be reported at once. If fail_fast is
+  /// set, parsing stops at the first error, which is cheaper for input that
+  /// is expected to be invalid every now and then.
+  bool fail_fast = false;
+
+  /// By default, the alternatives of an untagged std::variant are tried one
+  /// after the other. If classify_variants is set, the input is inspected
+  /// first and only those alternatives are tried that can be read from this
+  /// kind of input and whose required fields are all present. The error
+  /// message then only lists the alternatives that have been tried.
+  bool classify_variants = false;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -7,6 +7,7 @@
 #include <exception>
 #include <map>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -17,6 +18,7 @@
 
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/json/ReadOptions.hpp"
 
 namespace rfl {
 namespace json {
@@ -61,11 +63,34 @@ struct Reader {
   template <class T>
   static constexpr bool has_custom_constructor = has_from_json_obj<T>::value;
 
+  Reader()
+      : allow_borrowing_(true), classify_variants_(false), fail_fast_(false) {}
+
+  /// Takes fail_fast and classify_variants from _opts. _allow_borrowing
+  /// signals whether the underlying document outlives the parsed value,
+  /// which is required for std::string_view.
+  Reader(const ReadOptions& _opts, const bool _allow_borrowing)
+      : allow_borrowing_(_allow_borrowing),
+        classify_variants_(_opts.classify_variants),
+        fail_fast_(_opts.fail_fast) {}
+
+  /// Whether only those alternatives of an untagged variant should be tried
+  /// that could possibly match the input.
+  bool classify_variants() const noexcept { return classify_variants_; }
+
+  /// Whether parsing should stop at the first error instead of collecting
+  /// all of them.
+  bool fail_fast() const noexcept { return fail_fast_; }
+
+  /// The name does not have to be null-terminated.
   rfl::Result<InputVarType> get_field(
-      const std::string& _name, const InputObjectType _obj) const noexcept {
-    const auto var = InputVarType(yyjson_obj_get(_obj.val_, _name.c_str()));
+      const std::string_view& _name,
+      const InputObjectType _obj) const noexcept {
+    const auto var = InputVarType(
+        yyjson_obj_getn(_obj.val_, _name.data(), _name.size()));
     if (!var.val_) {
-      return rfl::Error("Object contains no field named '" + _name + "'.");
+      return rfl::Error("Object contains no field named '" +
+                        std::string(_name) + "'.");
     }
     return var;
   }
@@ -79,32 +104,56 @@ struct Reader {
     if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
       const auto r = yyjson_get_str(_var.val_);
       if (r == NULL) {
-        return rfl::Error("Could not cast to string.");
+        return rfl::Error::from_static("Could not cast to string.");
+      }
+      return std::string(r, yyjson_get_len(_var.val_));
+    } else if constexpr (std::is_same<std::decay_t<T>, std::string_view>()) {
+      if (!allow_borrowing_) {
+        return rfl::Error(
+            "Fields of type std::string_view must be read using "
+            "rfl::json::read_borrowed(...), because they point into the "
+            "underlying document.");
+      }
+      const auto r = yyjson_get_str(_var.val_);
+      if (r == NULL) {
+        return rfl::Error::from_static("Could not cast to string.");
       }
-      return std::string(r);
+      return std::string_view(r, yyjson_get_len(_var.val_));
     } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
       if (!yyjson_is_bool(_var.val_)) {
-        return rfl::Error("Could not cast to boolean.");
+        return rfl::Error::from_static("Could not cast to boolean.");
       }
       return yyjson_get_bool(_var.val_);
     } else if constexpr (std::is_floating_point<std::decay_t<T>>()) {
       if (!yyjson_is_num(_var.val_)) {
-        return rfl::Error("Could not cast to double.");
+        return rfl::Error::from_static("Could not cast to double.");
       }
       return static_cast<T>(yyjson_get_num(_var.val_));
     } else if constexpr (std::is_integral<std::decay_t<T>>()) {
       if (!yyjson_is_int(_var.val_)) {
-        return rfl::Error("Could not cast to int.");
+        return rfl::Error::from_static("Could not cast to int.");
       }
-      return static_cast<T>(yyjson_get_int(_var.val_));
+      return static_cast<T>(yyjson_get_sint(_var.val_));
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
   }
 
+  /// Returns a view of the string, which is valid for as long as the
+  /// document. Unlike to_basic_type<std::string_view>(...), this is only
+  /// meant to be used while parsing, so it does not require borrowing.
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType _var) const noexcept {
+    const auto r = yyjson_get_str(_var.val_);
+    if (r == NULL) {
+      return rfl::Error::from_static("Could not cast to string.");
+    }
+    return std::string_view(r, yyjson_get_len(_var.val_));
+  }
+
   rfl::Result<InputArrayType> to_array(const InputVarType _var) const noexcept {
     if (!yyjson_is_arr(_var.val_)) {
-      return rfl::Error("Could not cast to array!");
+      return rfl::Error::from_static("Could not cast to array!");
     }
     return InputArrayType(_var.val_);
   }
@@ -117,8 +166,8 @@ struct Reader {
     yyjson_obj_iter_init(_obj.val_, &iter);
     yyjson_val* key;
     while ((key = yyjson_obj_iter_next(&iter))) {
-      const char* k = yyjson_get_str(key);
-      const auto ix = _fct(std::string_view(k));
+      const auto ix = _fct(
+          std::string_view(yyjson_get_str(key), yyjson_get_len(key)));
       if (ix != -1) {
         f_arr[ix] = InputVarType(yyjson_obj_iter_get_val(key));
       }
@@ -140,10 +189,34 @@ struct Reader {
     return m;
   }
 
+  /// Calls _fct for each key-value pair of the object, until it returns an
+  /// error.
+  template <class FunctionType>
+  std::optional<Error> read_object(const FunctionType& _fct,
+                                   const InputObjectType _obj) const noexcept {
+    yyjson_obj_iter iter;
+    yyjson_obj_iter_init(_obj.val_, &iter);
+    yyjson_val* key;
+    while ((key = yyjson_obj_iter_next(&iter))) {
+      auto err =
+          _fct(std::string_view(yyjson_get_str(key), yyjson_get_len(key)),
+               InputVarType(yyjson_obj_iter_get_val(key)));
+      if (err) {
+        return err;
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// The number of key-value pairs in the object.
+  size_t object_size(const InputObjectType _obj) const noexcept {
+    return yyjson_obj_size(_obj.val_);
+  }
+
   rfl::Result<InputObjectType> to_object(
       const InputVarType _var) const noexcept {
     if (!yyjson_is_obj(_var.val_)) {
-      return rfl::Error("Could not cast to object!");
+      return rfl::Error::from_static("Could not cast to object!");
     }
     return InputObjectType(_var.val_);
   }
@@ -159,6 +232,61 @@ struct Reader {
     return vec;
   }
 
+  /// Calls _fct for each element of the array, until it returns an error.
+  template <class FunctionType>
+  std::optional<Error> read_array(const FunctionType& _fct,
+                                  const InputArrayType _arr) const noexcept {
+    yyjson_val* val;
+    yyjson_arr_iter iter;
+    yyjson_arr_iter_init(_arr.val_, &iter);
+    while ((val = yyjson_arr_iter_next(&iter))) {
+      auto err = _fct(InputVarType(val));
+      if (err) {
+        return err;
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// The number of elements in the array.
+  size_t array_size(const InputArrayType _arr) const noexcept {
+    return yyjson_arr_size(_arr.val_);
+  }
+
+  /// Reads an array of numbers in a single pass. _get_buffer is called once
+  /// with the number of elements and returns the output iterator they are
+  /// written to.
+  template <class T, class BufferFunctionType>
+  std::optional<Error> read_numbers(
+      const InputVarType _var,
+      const BufferFunctionType& _get_buffer) const noexcept {
+    if (!yyjson_is_arr(_var.val_)) {
+      return rfl::Error::from_static("Could not cast to array!");
+    }
+    auto buffer = _get_buffer(yyjson_arr_size(_var.val_));
+    if (!buffer) {
+      return std::move(*buffer.error());
+    }
+    auto out = *buffer;
+    yyjson_val* val;
+    yyjson_arr_iter iter;
+    yyjson_arr_iter_init(_var.val_, &iter);
+    while ((val = yyjson_arr_iter_next(&iter))) {
+      if constexpr (std::is_floating_point<T>()) {
+        if (!yyjson_is_num(val)) {
+          return rfl::Error::from_static("Could not cast to double.");
+        }
+        *(out++) = static_cast<T>(yyjson_get_num(val));
+      } else {
+        if (!yyjson_is_int(val)) {
+          return rfl::Error::from_static("Could not cast to int.");
+        }
+        *(out++) = static_cast<T>(yyjson_get_sint(val));
+      }
+    }
+    return std::nullopt;
+  }
+
   template <class T>
   rfl::Result<T> use_custom_constructor(
       const InputVarType _var) const noexcept {
@@ -168,6 +296,17 @@ struct Reader {
       return rfl::Error(e.what());
     }
   }
+
+ private:
+  /// Whether the underlying document outlives the parsed value.
+  bool allow_borrowing_;
+
+  /// Whether the input should be classified before parsing untagged
+  /// variants.
+  bool classify_variants_;
+
+  /// Whether parsing should stop at the first error.
+  bool fail_fast_;
 };
 
 }  // namespace json
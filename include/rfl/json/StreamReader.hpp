@@ -0,0 +1,229 @@
+#ifndef RFL_JSON_STREAMREADER_HPP_
+#define RFL_JSON_STREAMREADER_HPP_
+
+#include <yyjson.h>
+
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/json/Parser.hpp"
+#include "rfl/json/ReadOptions.hpp"
+#include "rfl/json/Reader.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Reads newline-delimited JSON (one record per line) from a stream, as
+/// returned by rfl::json::read_stream(...). The stream is read in chunks, so
+/// only the current chunk and the current line are held in memory. All
+/// records are parsed using the same buffer and, unless the options contain
+/// an allocator of their own, the same memory pool, so reading a record does
+/// not require any allocations apart from those of T itself.
+template <class T>
+class StreamReader {
+  using PtrType = std::unique_ptr<yyjson_doc, void (*)(yyjson_doc*)>;
+
+ public:
+  /// The size of the chunks read from the stream.
+  static constexpr size_t chunk_size_ = 65536;
+
+  /// An input iterator over the records. Reaching the end of the stream
+  /// compares equal to std::default_sentinel.
+  class Iterator {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = Result<T>;
+
+    Iterator() : reader_(nullptr) {}
+
+    explicit Iterator(StreamReader<T>* _reader) : reader_(_reader) {
+      ++(*this);
+    }
+
+    Result<T>& operator*() const { return *current_; }
+
+    Iterator& operator++() {
+      current_ = reader_->next();
+      return *this;
+    }
+
+    void operator++(int) { ++(*this); }
+
+    friend bool operator==(const Iterator& _it, std::default_sentinel_t) {
+      return !_it.current_;
+    }
+
+   private:
+    /// The reader the records are taken from.
+    StreamReader<T>* reader_;
+
+    /// The record the iterator currently points to.
+    mutable std::optional<Result<T>> current_;
+  };
+
+  StreamReader(std::istream* _stream, const ReadOptions& _opts)
+      : chunk_(chunk_size_),
+        begin_(0),
+        end_(0),
+        eof_(false),
+        failed_(false),
+        line_num_(0),
+        opts_(_opts),
+        stream_(_stream) {
+    opts_.flags &= ~YYJSON_READ_INSITU;
+  }
+
+  StreamReader(const StreamReader<T>& _other) = delete;
+
+  StreamReader(StreamReader<T>&& _other) noexcept = default;
+
+  ~StreamReader() = default;
+
+  /// Returns an iterator pointing to the first record that has not been
+  /// read yet.
+  Iterator begin() { return Iterator(this); }
+
+  /// The end of the stream.
+  std::default_sentinel_t end() const noexcept {
+    return std::default_sentinel;
+  }
+
+  /// Reads the next record or returns std::nullopt, if the end of the stream
+  /// has been reached. Empty lines are skipped. A line that cannot be parsed
+  /// results in an error, after which reading continues with the next line.
+  /// If reading from the stream fails, the incomplete line is discarded and
+  /// the failure is returned as the last error.
+  std::optional<Result<T>> next() {
+    std::string_view line;
+    while (next_line(&line)) {
+      if (line.find_first_not_of(" \t\r") != std::string_view::npos) {
+        return parse(line);
+      }
+    }
+    if (failed_) {
+      failed_ = false;
+      return Result<T>(Error("Could not read line " +
+                             std::to_string(line_num_ + 1) +
+                             " from the stream."));
+    }
+    return std::nullopt;
+  }
+
+  StreamReader<T>& operator=(const StreamReader<T>& _other) = delete;
+
+  StreamReader<T>& operator=(StreamReader<T>&& _other) noexcept = default;
+
+ private:
+  /// Finds the next line in the chunk, reading more from the stream if
+  /// necessary. The chunk only grows, if a single line does not fit into it.
+  bool next_line(std::string_view* _line) {
+    size_t searched = begin_;
+    while (true) {
+      const auto nl = static_cast<const char*>(
+          std::memchr(chunk_.data() + searched, '\n', end_ - searched));
+      if (nl) {
+        const auto pos = static_cast<size_t>(nl - chunk_.data());
+        *_line = std::string_view(chunk_.data() + begin_, pos - begin_);
+        begin_ = pos + 1;
+        ++line_num_;
+        return true;
+      }
+      if (eof_) {
+        if (failed_) {
+          begin_ = end_;
+        }
+        if (begin_ == end_) {
+          return false;
+        }
+        *_line = std::string_view(chunk_.data() + begin_, end_ - begin_);
+        begin_ = end_;
+        ++line_num_;
+        return true;
+      }
+      if (begin_ > 0) {
+        std::memmove(chunk_.data(), chunk_.data() + begin_, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0;
+      }
+      if (end_ == chunk_.size()) {
+        chunk_.resize(chunk_.size() * 2);
+      }
+      searched = end_;
+      stream_->read(chunk_.data() + end_, chunk_.size() - end_);
+      end_ += static_cast<size_t>(stream_->gcount());
+      failed_ = stream_->bad();
+      eof_ = !(*stream_);
+    }
+  }
+
+  /// Parses a single line using the shared memory pool.
+  Result<T> parse(const std::string_view _line) {
+    const yyjson_alc* alc = opts_.alc;
+    yyjson_alc pool;
+    if (!alc) {
+      const auto size = yyjson_read_max_memory_usage(_line.size(), opts_.flags);
+      if (pool_.size() < size) {
+        pool_.resize(size);
+      }
+      yyjson_alc_pool_init(&pool, pool_.data(), pool_.size());
+      alc = &pool;
+    }
+    yyjson_read_err err;
+    yyjson_doc* doc =
+        yyjson_read_opts(const_cast<char*>(_line.data()), _line.size(),
+                         opts_.flags, alc, &err);
+    if (!doc) {
+      return Error("Could not parse JSON in line " +
+                   std::to_string(line_num_) + ": " + std::string(err.msg) +
+                   " (at position " + std::to_string(err.pos) + ").");
+    }
+    const auto ptr = PtrType(doc, yyjson_doc_free);
+    const auto r = Reader(opts_, false);
+    return Parser<T>::read(r, typename Reader::InputVarType(
+                                  yyjson_doc_get_root(doc)));
+  }
+
+ private:
+  /// The chunk read from the stream. Only the bytes in [begin_, end_) have
+  /// not been consumed yet.
+  std::vector<char> chunk_;
+
+  /// The beginning of the unconsumed bytes in chunk_.
+  size_t begin_;
+
+  /// The end of the bytes read into chunk_.
+  size_t end_;
+
+  /// Whether the end of the stream has been reached.
+  bool eof_;
+
+  /// Whether reading from the stream failed and the failure has not been
+  /// returned yet.
+  bool failed_;
+
+  /// The number of the current line, used for the error messages.
+  size_t line_num_;
+
+  /// The options passed to rfl::json::read_stream(...).
+  ReadOptions opts_;
+
+  /// The memory pool the documents are parsed into.
+  std::vector<char> pool_;
+
+  /// The stream the records are read from.
+  std::istream* stream_;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
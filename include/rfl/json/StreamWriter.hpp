@@ -0,0 +1,77 @@
+#ifndef RFL_JSON_STREAMWRITER_HPP_
+#define RFL_JSON_STREAMWRITER_HPP_
+
+#include <ostream>
+#include <string>
+
+#include "rfl/json/Parser.hpp"
+#include "rfl/json/Writer.hpp"
+#include "rfl/parsing/Parent.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Appends records to a stream as newline-delimited JSON (one record per
+/// line). The records are written into a single buffer, which is reused for
+/// all of them and flushed into the stream whenever it grows beyond
+/// Writer::buffer_size_, so no string is built for any individual record.
+class StreamWriter {
+ public:
+  explicit StreamWriter(std::ostream* _stream)
+      : stream_(_stream), w_(&buffer_, _stream) {
+    buffer_.reserve(Writer::buffer_size_);
+  }
+
+  /// The underlying Writer points to buffer_, so StreamWriter can be
+  /// neither copied nor moved.
+  StreamWriter(const StreamWriter& _other) = delete;
+
+  StreamWriter(StreamWriter&& _other) = delete;
+
+  /// Writes whatever is left in the buffer. A destructor cannot report
+  /// errors, so anything the stream throws is swallowed here. Call flush()
+  /// before the StreamWriter is destroyed to find out whether writing
+  /// succeeded.
+  ~StreamWriter() {
+    try {
+      flush();
+    } catch (...) {
+    }
+  }
+
+  /// Appends a single record, followed by a newline.
+  template <class T>
+  void write(const T& _obj) {
+    using ParentType = parsing::Parent<Writer>;
+    Parser<T>::write(w_, _obj, typename ParentType::Root{});
+    buffer_.push_back('\n');
+    if (buffer_.size() >= Writer::buffer_size_) {
+      w_.flush();
+    }
+  }
+
+  /// Writes everything that is still in the buffer into the stream.
+  void flush() {
+    w_.flush();
+    stream_->flush();
+  }
+
+  StreamWriter& operator=(const StreamWriter& _other) = delete;
+
+  StreamWriter& operator=(StreamWriter&& _other) = delete;
+
+ private:
+  /// The buffer shared by all records.
+  std::string buffer_;
+
+  /// The stream the records are written into.
+  std::ostream* stream_;
+
+  /// Writes the records into buffer_.
+  Writer w_;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
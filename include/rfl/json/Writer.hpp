@@ -1,94 +1,332 @@
 #ifndef RFL_JSON_WRITER_HPP_
 #define RFL_JSON_WRITER_HPP_
 
-#include <yyjson.h>
-
-#include <exception>
-#include <map>
-#include <sstream>
-#include <stdexcept>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
-#include <vector>
 
-#include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/internal/strings/NumberString.hpp"
 
 namespace rfl {
 namespace json {
 
-struct Writer {
-  struct YYJSONOutputArray {
-    YYJSONOutputArray(yyjson_mut_val* _val) : val_(_val) {}
-    yyjson_mut_val* val_;
+/// Emits the JSON directly into a string while the parsers traverse the
+/// objects, without building a document tree first. If a stream is passed,
+/// the string is used as a buffer, which is flushed into the stream whenever
+/// it grows beyond buffer_size_.
+class Writer {
+ public:
+  struct JSONOutputArray {
+    /// Whether no element has been added to the array yet.
+    bool empty_ = true;
   };
 
-  struct YYJSONOutputObject {
-    YYJSONOutputObject(yyjson_mut_val* _val) : val_(_val) {}
-    yyjson_mut_val* val_;
+  struct JSONOutputObject {
+    /// Whether no field has been added to the object yet.
+    bool empty_ = true;
   };
 
-  struct YYJSONOutputVar {
-    YYJSONOutputVar(yyjson_mut_val* _val) : val_(_val) {}
+  struct JSONOutputVar {};
 
-    YYJSONOutputVar(YYJSONOutputArray _arr) : val_(_arr.val_) {}
+  using OutputArrayType = JSONOutputArray;
+  using OutputObjectType = JSONOutputObject;
+  using OutputVarType = JSONOutputVar;
 
-    YYJSONOutputVar(YYJSONOutputObject _obj) : val_(_obj.val_) {}
+  /// The size at which the buffer is flushed into the stream.
+  static constexpr size_t buffer_size_ = 65536;
 
-    yyjson_mut_val* val_;
-  };
+ public:
+  Writer(std::string* _buffer, std::ostream* _stream = nullptr)
+      : buffer_(_buffer), stream_(_stream) {}
+
+  ~Writer() = default;
 
-  using OutputArrayType = YYJSONOutputArray;
-  using OutputObjectType = YYJSONOutputObject;
-  using OutputVarType = YYJSONOutputVar;
+  OutputArrayType array_as_root() const noexcept {
+    buffer_->push_back('[');
+    return OutputArrayType{};
+  }
 
-  Writer(yyjson_mut_doc* _doc) : doc_(_doc) {}
+  OutputObjectType object_as_root() const noexcept {
+    buffer_->push_back('{');
+    return OutputObjectType{};
+  }
 
-  ~Writer() = default;
+  OutputVarType null_as_root() const noexcept {
+    buffer_->append("null");
+    return OutputVarType{};
+  }
+
+  template <class T>
+  OutputVarType value_as_root(const T& _var) const noexcept {
+    write_value(_var);
+    return OutputVarType{};
+  }
+
+  OutputArrayType add_array_to_array(OutputArrayType* _parent) const noexcept {
+    start_element(_parent);
+    buffer_->push_back('[');
+    return OutputArrayType{};
+  }
+
+  OutputArrayType add_array_to_object(
+      const std::string_view& _name,
+      OutputObjectType* _parent) const noexcept {
+    start_field(_name, _parent);
+    buffer_->push_back('[');
+    return OutputArrayType{};
+  }
+
+  OutputObjectType add_object_to_array(
+      OutputArrayType* _parent) const noexcept {
+    start_element(_parent);
+    buffer_->push_back('{');
+    return OutputObjectType{};
+  }
+
+  OutputObjectType add_object_to_object(
+      const std::string_view& _name,
+      OutputObjectType* _parent) const noexcept {
+    start_field(_name, _parent);
+    buffer_->push_back('{');
+    return OutputObjectType{};
+  }
+
+  template <class T>
+  OutputVarType add_value_to_array(const T& _var,
+                                   OutputArrayType* _parent) const noexcept {
+    start_element(_parent);
+    write_value(_var);
+    return OutputVarType{};
+  }
+
+  template <class T>
+  OutputVarType add_value_to_object(const std::string_view& _name,
+                                    const T& _var,
+                                    OutputObjectType* _parent) const noexcept {
+    start_field(_name, _parent);
+    write_value(_var);
+    return OutputVarType{};
+  }
+
+  OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept {
+    start_element(_parent);
+    buffer_->append("null");
+    return OutputVarType{};
+  }
+
+  OutputVarType add_null_to_object(const std::string_view& _name,
+                                   OutputObjectType* _parent) const noexcept {
+    start_field(_name, _parent);
+    buffer_->append("null");
+    return OutputVarType{};
+  }
 
-  void add(const OutputVarType _var, OutputArrayType* _arr) const noexcept {
-    yyjson_mut_arr_add_val(_arr->val_, _var.val_);
+  void end_array(OutputArrayType* _arr) const noexcept {
+    buffer_->push_back(']');
+    flush_if_full();
   }
 
-  OutputVarType empty_var() const noexcept {
-    return OutputVarType(yyjson_mut_null(doc_));
+  void end_object(OutputObjectType* _obj) const noexcept {
+    buffer_->push_back('}');
+    flush_if_full();
+  }
+
+  /// Writes the content of the buffer into the stream, if there is one. If
+  /// the stream has failed, it reports the failure the way the stream is
+  /// configured to, which may be an exception.
+  void flush() const {
+    if (stream_) {
+      stream_->write(buffer_->data(), buffer_->size());
+      buffer_->clear();
+    }
+  }
+
+ private:
+  /// Flushes the buffer while the object is still being written. This is
+  /// called from noexcept functions, so an exception thrown by the stream is
+  /// caught here. The failure remains in the state of the stream and the
+  /// rest of the output is discarded, until the final call to flush()
+  /// reports it.
+  void flush_if_full() const noexcept {
+    if (!stream_ || buffer_->size() < buffer_size_) {
+      return;
+    }
+    if (stream_->good()) {
+      try {
+        stream_->write(buffer_->data(), buffer_->size());
+      } catch (...) {
+      }
+    }
+    buffer_->clear();
+  }
+
+  /// Adds the separator, unless this is the first element.
+  void start_element(OutputArrayType* _parent) const noexcept {
+    if (!_parent->empty_) {
+      buffer_->push_back(',');
+    }
+    _parent->empty_ = false;
+  }
+
+  /// Adds the separator, unless this is the first field, and the key.
+  void start_field(const std::string_view& _name,
+                   OutputObjectType* _parent) const noexcept {
+    if (!_parent->empty_) {
+      buffer_->push_back(',');
+    }
+    _parent->empty_ = false;
+    write_string(_name);
+    buffer_->push_back(':');
   }
 
   template <class T>
-  OutputVarType from_basic_type(const T& _var) const noexcept {
-    if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
-      return OutputVarType(yyjson_mut_strcpy(doc_, _var.c_str()));
+  void write_value(const T& _var) const noexcept {
+    if constexpr (std::is_same<std::decay_t<T>, std::string>() ||
+                  std::is_same<std::decay_t<T>, std::string_view>()) {
+      write_string(_var);
     } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
-      return OutputVarType(yyjson_mut_bool(doc_, _var));
+      buffer_->append(_var ? "true" : "false");
     } else if constexpr (std::is_floating_point<std::decay_t<T>>()) {
-      return OutputVarType(yyjson_mut_real(doc_, static_cast<double>(_var)));
+      write_double(static_cast<double>(_var));
     } else if constexpr (std::is_integral<std::decay_t<T>>()) {
-      return OutputVarType(yyjson_mut_int(doc_, static_cast<int>(_var)));
+      buffer_->append(internal::strings::NumberString(_var).view());
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
   }
 
-  OutputArrayType new_array() const noexcept {
-    return OutputArrayType(yyjson_mut_arr(doc_));
+  /// Writes a quoted string. Most strings do not contain any characters that
+  /// need to be escaped, so they are copied in a single pass.
+  void write_string(const std::string_view& _str) const noexcept {
+    buffer_->push_back('"');
+    auto begin = _str.data();
+    const auto end = _str.data() + _str.size();
+    for (auto it = begin; it != end; ++it) {
+      const auto c = static_cast<unsigned char>(*it);
+      if (c >= 0x20 && c != '"' && c != '\\') {
+        continue;
+      }
+      buffer_->append(begin, it);
+      write_escaped(c);
+      begin = it + 1;
+    }
+    buffer_->append(begin, end);
+    buffer_->push_back('"');
   }
 
-  OutputObjectType new_object() const noexcept {
-    return OutputObjectType(yyjson_mut_obj(doc_));
+  void write_escaped(const unsigned char _c) const noexcept {
+    switch (_c) {
+      case '"':
+        buffer_->append("\\\"");
+        break;
+      case '\\':
+        buffer_->append("\\\\");
+        break;
+      case '\b':
+        buffer_->append("\\b");
+        break;
+      case '\f':
+        buffer_->append("\\f");
+        break;
+      case '\n':
+        buffer_->append("\\n");
+        break;
+      case '\r':
+        buffer_->append("\\r");
+        break;
+      case '\t':
+        buffer_->append("\\t");
+        break;
+      default: {
+        constexpr const char* hex = "0123456789ABCDEF";
+        buffer_->append("\\u00");
+        buffer_->push_back(hex[_c >> 4]);
+        buffer_->push_back(hex[_c & 15]);
+        break;
+      }
+    }
   }
 
-  bool is_empty(const OutputVarType& _var) const noexcept {
-    return yyjson_mut_is_null(_var.val_);
-  }
+  /// Writes the shortest representation that reads back to the same value,
+  /// in the same notation yyjson uses: Fixed notation for decimal exponents
+  /// between -6 and 20, always containing a decimal point, and scientific
+  /// notation otherwise. JSON has no representation for infinity and NaN, so
+  /// they are written as null.
+  void write_double(const double _d) const noexcept {
+    if (!std::isfinite(_d)) {
+      buffer_->append("null");
+      return;
+    }
+
+    if (_d == 0.0) {
+      buffer_->append(std::signbit(_d) ? "-0.0" : "0.0");
+      return;
+    }
+
+    char buf[32];
+    const auto end =
+        std::to_chars(buf, buf + sizeof(buf), _d, std::chars_format::scientific)
+            .ptr;
+
+    auto it = buf;
+    if (*it == '-') {
+      buffer_->push_back('-');
+      ++it;
+    }
 
-  void set_field(const std::string& _name, const OutputVarType& _var,
-                 OutputObjectType* _obj) const noexcept {
-    yyjson_mut_obj_add(_obj->val_, yyjson_mut_strcpy(doc_, _name.c_str()),
-                       _var.val_);
+    char digits[20];
+    int num_digits = 0;
+    for (; *it != 'e'; ++it) {
+      if (*it != '.') {
+        digits[num_digits++] = *it;
+      }
+    }
+
+    ++it;
+    if (*it == '+') {
+      ++it;
+    }
+    int exp = 0;
+    std::from_chars(it, end, exp);
+
+    if (exp >= -6 && exp <= 20) {
+      if (exp < 0) {
+        buffer_->append("0.");
+        buffer_->append(static_cast<size_t>(-exp - 1), '0');
+        buffer_->append(digits, num_digits);
+      } else if (num_digits <= exp + 1) {
+        buffer_->append(digits, num_digits);
+        buffer_->append(static_cast<size_t>(exp + 1 - num_digits), '0');
+        buffer_->append(".0");
+      } else {
+        buffer_->append(digits, exp + 1);
+        buffer_->push_back('.');
+        buffer_->append(digits + exp + 1, num_digits - exp - 1);
+      }
+    } else {
+      buffer_->push_back(digits[0]);
+      if (num_digits > 1) {
+        buffer_->push_back('.');
+        buffer_->append(digits + 1, num_digits - 1);
+      }
+      buffer_->push_back('e');
+      const auto exp_end = std::to_chars(buf, buf + sizeof(buf), exp).ptr;
+      buffer_->append(buf, exp_end);
+    }
   }
 
-  yyjson_mut_doc* doc_;
+ private:
+  /// The buffer the JSON is written into.
+  std::string* buffer_;
+
+  /// The stream the buffer is flushed into, if any.
+  std::ostream* stream_;
 };
 
 }  // namespace json
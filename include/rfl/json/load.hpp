@@ -2,16 +2,26 @@
 #define RFL_JSON_LOAD_HPP_
 
 #include "rfl/Result.hpp"
-#include "rfl/io/load_string.hpp"
+#include "rfl/io/MappedFile.hpp"
+#include "rfl/json/ReadOptions.hpp"
 #include "rfl/json/read.hpp"
 
 namespace rfl {
 namespace json {
 
+/// Loads an object from a JSON file. The file is mapped into memory and
+/// parsed straight from the mapping, so it is not copied into a string
+/// first. The mapping is read-only, so YYJSON_READ_INSITU is ignored.
 template <class T>
-Result<T> load(const std::string& _fname) {
-  const auto read_string = [](const auto& _str) { return read<T>(_str); };
-  return rfl::io::load_string(_fname).and_then(read_string);
+Result<T> load(const std::string& _fname,
+               const ReadOptions& _opts = ReadOptions()) {
+  auto opts = _opts;
+  opts.flags &= ~YYJSON_READ_INSITU;
+  const auto read_file = [&](const io::MappedFile& _file) {
+    return read_from_buffer<T>(const_cast<char*>(_file.data()), _file.size(),
+                               opts, false);
+  };
+  return io::MappedFile::open(_fname).and_then(read_file);
 }
 
 }  // namespace json
@@ -4,10 +4,21 @@
 #include <yyjson.h>
 
 #include <istream>
+#include <iterator>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
 
+#include "rfl/Parallel.hpp"
+#include "rfl/internal/stats/Timer.hpp"
+#include "rfl/json/Borrowed.hpp"
 #include "rfl/json/Parser.hpp"
+#include "rfl/json/ReadOptions.hpp"
 #include "rfl/json/Reader.hpp"
+#include "rfl/json/Writer.hpp"
+#include "rfl/parsing/ParallelParser.hpp"
 
 namespace rfl {
 namespace json {
@@ -22,21 +33,106 @@ Result<T> read(const InputVarType& _obj) {
   return Parser<T>::read(r, _obj);
 }
 
-/// Parses an object from JSON using reflection.
+/// Parses _size bytes starting at _buf and reads the object from the
+/// resulting document. _allow_borrowing signals whether the buffer outlives
+/// the result. If _parallel is passed, the elements of a top-level
+/// std::vector are parsed concurrently.
 template <class T>
-Result<T> read(const std::string& _json_str) {
+Result<T> read_from_buffer(
+    char* _buf, const size_t _size, const ReadOptions& _opts,
+    const bool _allow_borrowing,
+    const std::optional<Parallel>& _parallel = std::nullopt) {
   using PtrType = std::unique_ptr<yyjson_doc, void (*)(yyjson_doc*)>;
-  yyjson_doc* doc = yyjson_read(_json_str.c_str(), _json_str.size(), 0);
+  yyjson_read_err err;
+  yyjson_doc* doc = yyjson_read_opts(_buf, _size, _opts.flags, _opts.alc, &err);
+  if (!doc) {
+    return Error("Could not parse JSON: " + std::string(err.msg) +
+                 " (at position " + std::to_string(err.pos) + ").");
+  }
   const auto ptr = PtrType(doc, yyjson_doc_free);
-  return read<T>(InputVarType(yyjson_doc_get_root(doc)));
+  internal::stats::record_bytes_read<T>(_size);
+  const auto r = Reader(_opts, _allow_borrowing);
+  const auto root = InputVarType(yyjson_doc_get_root(doc));
+  if (_parallel) {
+    return parsing::ParallelParser<Reader, Writer, T>::read(
+        r, root, _parallel->threads);
+  }
+  return Parser<T>::read(r, root);
 }
 
-/// Parses an object from a stringstream.
+/// Parses an object from JSON using reflection. The string is never
+/// modified, so YYJSON_READ_INSITU is ignored.
 template <class T>
-Result<T> read(std::istream& _stream) {
-  const auto json_str = std::string(std::istreambuf_iterator<char>(_stream),
-                                    std::istreambuf_iterator<char>());
-  return read<T>(json_str);
+Result<T> read(const std::string& _json_str,
+               const ReadOptions& _opts = ReadOptions()) {
+  auto opts = _opts;
+  opts.flags &= ~YYJSON_READ_INSITU;
+  return read_from_buffer<T>(const_cast<char*>(_json_str.data()),
+                             _json_str.size(), opts, false);
+}
+
+/// Parses an object from JSON using reflection. If T is a std::vector, its
+/// elements are parsed concurrently using _parallel.threads threads. For any
+/// other type, this is the same as read<T>(_json_str, _opts).
+template <class T>
+Result<T> read(const std::string& _json_str, const Parallel& _parallel,
+               const ReadOptions& _opts = ReadOptions()) {
+  auto opts = _opts;
+  opts.flags &= ~YYJSON_READ_INSITU;
+  return read_from_buffer<T>(const_cast<char*>(_json_str.data()),
+                             _json_str.size(), opts, false, _parallel);
+}
+
+/// Parses an object from a mutable buffer. If _opts.flags contains
+/// YYJSON_READ_INSITU, the buffer is parsed in place without being copied.
+/// In that case, it must be followed by at least YYJSON_PADDING_SIZE zero
+/// bytes, its content is undefined afterwards and fields of type
+/// std::string_view point directly into it.
+template <class T>
+Result<T> read(char* _buf, const size_t _size,
+               const ReadOptions& _opts = ReadOptions()) {
+  const bool insitu = (_opts.flags & YYJSON_READ_INSITU) != 0;
+  return read_from_buffer<T>(_buf, _size, _opts, insitu);
+}
+
+/// Parses an object from JSON using reflection without copying the strings.
+/// Fields of type std::string_view point directly into the parsed document,
+/// which is kept alive inside the returned rfl::json::Borrowed. If you pass
+/// a custom allocator, it must outlive the rfl::json::Borrowed as well.
+template <class T>
+Result<Borrowed<T>> read_borrowed(const std::string_view _json_str,
+                                  const ReadOptions& _opts = ReadOptions()) {
+  using DocPtrType = typename Borrowed<T>::DocPtrType;
+  yyjson_read_err err;
+  auto doc = DocPtrType(
+      yyjson_read_opts(const_cast<char*>(_json_str.data()), _json_str.size(),
+                       _opts.flags & ~YYJSON_READ_INSITU, _opts.alc, &err),
+      yyjson_doc_free);
+  if (!doc) {
+    return Error("Could not parse JSON: " + std::string(err.msg) +
+                 " (at position " + std::to_string(err.pos) + ").");
+  }
+  internal::stats::record_bytes_read<T>(_json_str.size());
+  const auto to_borrowed = [&doc](T&& _value) {
+    return Borrowed<T>(std::move(doc), std::move(_value));
+  };
+  const auto r = Reader(_opts, true);
+  return Parser<T>::read(r, InputVarType(yyjson_doc_get_root(doc.get())))
+      .transform(to_borrowed);
+}
+
+/// Parses an object from a stringstream. The stream is read into a single
+/// buffer, which is then parsed in place.
+template <class T>
+Result<T> read(std::istream& _stream,
+               const ReadOptions& _opts = ReadOptions()) {
+  auto json_str = std::string(std::istreambuf_iterator<char>(_stream),
+                              std::istreambuf_iterator<char>());
+  const auto size = json_str.size();
+  json_str.append(YYJSON_PADDING_SIZE, '\0');
+  auto opts = _opts;
+  opts.flags |= YYJSON_READ_INSITU;
+  return read_from_buffer<T>(json_str.data(), size, opts, false);
 }
 
 }  // namespace json
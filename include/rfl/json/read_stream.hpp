@@ -0,0 +1,27 @@
+#ifndef RFL_JSON_READ_STREAM_HPP_
+#define RFL_JSON_READ_STREAM_HPP_
+
+#include <istream>
+
+#include "rfl/json/ReadOptions.hpp"
+#include "rfl/json/StreamReader.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Reads newline-delimited JSON from a stream. The records are parsed
+/// lazily, one line at a time, while iterating over the returned range:
+///
+///   for (const auto& person : rfl::json::read_stream<Person>(stream)) { }
+///
+/// Every element is a Result<T>. The stream must outlive the range.
+template <class T>
+StreamReader<T> read_stream(std::istream& _stream,
+                            const ReadOptions& _opts = ReadOptions()) {
+  return StreamReader<T>(&_stream, _opts);
+}
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -1,13 +1,13 @@
 #ifndef RFL_JSON_WRITE_HPP_
 #define RFL_JSON_WRITE_HPP_
 
-#include <yyjson.h>
-
 #include <ostream>
 #include <sstream>
 #include <string>
 
+#include "rfl/internal/stats/Timer.hpp"
 #include "rfl/json/Parser.hpp"
+#include "rfl/parsing/Parent.hpp"
 
 namespace rfl {
 namespace json {
@@ -15,26 +15,26 @@ namespace json {
 /// Returns a JSON string.
 template <class T>
 std::string write(const T& _obj) {
-  auto w = Writer(yyjson_mut_doc_new(NULL));
-  const auto json_obj = Parser<T>::write(w, _obj);
-  yyjson_mut_doc_set_root(w.doc_, json_obj.val_);
-  const char* json_c_str = yyjson_mut_write(w.doc_, 0, NULL);
-  const auto json_str = std::string(json_c_str);
-  free((void*)json_c_str);
-  yyjson_mut_doc_free(w.doc_);
+  using ParentType = parsing::Parent<Writer>;
+  auto json_str = std::string();
+  const auto w = Writer(&json_str);
+  Parser<T>::write(w, _obj, typename ParentType::Root{});
+  internal::stats::record_bytes_written<T>(json_str.size());
   return json_str;
 }
 
-/// Writes a JSON into an ostream.
+/// Writes a JSON into an ostream. The JSON is flushed into the stream in
+/// chunks, so it never has to be held in memory as a whole. Failures are
+/// reported through the state of the stream, or as std::ios_base::failure
+/// if exceptions are enabled on the stream.
 template <class T>
 std::ostream& write(const T& _obj, std::ostream& _stream) {
-  auto w = Writer(yyjson_mut_doc_new(NULL));
-  const auto json_obj = Parser<T>::write(w, _obj);
-  yyjson_mut_doc_set_root(w.doc_, json_obj.val_);
-  const char* json_c_str = yyjson_mut_write(w.doc_, 0, NULL);
-  _stream << json_c_str;
-  free((void*)json_c_str);
-  yyjson_mut_doc_free(w.doc_);
+  using ParentType = parsing::Parent<Writer>;
+  auto buffer = std::string();
+  buffer.reserve(Writer::buffer_size_);
+  const auto w = Writer(&buffer, &_stream);
+  Parser<T>::write(w, _obj, typename ParentType::Root{});
+  w.flush();
   return _stream;
 }
 
@@ -0,0 +1,26 @@
+#ifndef RFL_JSON_WRITE_STREAM_HPP_
+#define RFL_JSON_WRITE_STREAM_HPP_
+
+#include <ostream>
+
+#include "rfl/json/StreamWriter.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Writes all records in _records into an ostream as newline-delimited JSON.
+/// To append records one at a time, use rfl::json::StreamWriter instead.
+template <class RangeType>
+std::ostream& write_stream(const RangeType& _records, std::ostream& _stream) {
+  auto w = StreamWriter(&_stream);
+  for (const auto& record : _records) {
+    w.write(record);
+  }
+  w.flush();
+  return _stream;
+}
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -35,9 +35,11 @@ struct CustomParser {
             .and_then(to_class);
     }
 
-    static auto write(const WriterType& _w, const OriginalClass& _p) noexcept {
-        return Parser<ReaderType, WriterType, HelperStruct>::write(
-            _w, HelperStruct::from_class(_p));
+    template <class P>
+    static void write(const WriterType& _w, const OriginalClass& _p,
+                      const P& _parent) noexcept {
+        Parser<ReaderType, WriterType, HelperStruct>::write(
+            _w, HelperStruct::from_class(_p), _parent);
     }
 };
 
@@ -15,11 +15,14 @@ namespace rfl {
 namespace parsing {
 
 template <class R, class T>
-concept IsReader = requires(R r, std::string name,
-                            std::function<std::int16_t(std::string_view)> fct,
-                            typename R::InputArrayType arr,
-                            typename R::InputObjectType obj,
-                            typename R::InputVarType var) {
+concept IsReader = requires(
+    R r, std::string name, std::function<std::int16_t(std::string_view)> fct,
+    std::function<std::optional<Error>(typename R::InputVarType)> array_fct,
+    std::function<std::optional<Error>(std::string_view,
+                                       typename R::InputVarType)>
+        object_fct,
+    typename R::InputArrayType arr, typename R::InputObjectType obj,
+    typename R::InputVarType var) {
   /// Any Reader needs to define the following:
   ///
   /// 1) An InputArrayType, which must be an array-like data structure.
@@ -60,6 +63,10 @@ concept IsReader = requires(R r, std::string name,
     } -> std::same_as<
         std::vector<std::pair<std::string, typename R::InputVarType>>>;
 
+  /// Iterates through an object and calls object_fct for each of the
+  /// contained key-value pairs, until object_fct returns an error.
+  { r.read_object(object_fct, obj) } -> std::same_as<std::optional<Error>>;
+
   /// Casts var as an InputObjectType.
   {
     r.to_object(var)
@@ -69,6 +76,11 @@ concept IsReader = requires(R r, std::string name,
   /// a vector.
   { r.to_vec(arr) } -> std::same_as<std::vector<typename R::InputVarType>>;
 
+  /// Iterates through an array and calls array_fct for each of the contained
+  /// vars, until array_fct returns an error. This allows the parsers to read
+  /// the elements directly, without collecting them into a vector first.
+  { r.read_array(array_fct, arr) } -> std::same_as<std::optional<Error>>;
+
   /// Uses the custom constructor, if it has been determined that T has one
   /// (see above).
   { r.template use_custom_constructor<T>(var) } -> std::same_as<rfl::Result<T>>;
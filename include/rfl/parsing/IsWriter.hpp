@@ -2,6 +2,8 @@
 #define RFL_PARSING_ISWRITER_HPP_
 
 #include <concepts>
+#include <string>
+#include <string_view>
 
 #include "rfl/Result.hpp"
 
@@ -9,7 +11,8 @@ namespace rfl {
 namespace parsing {
 
 template <class W, class T>
-concept IsWriter = requires(W w, T t, std::string name,
+concept IsWriter = requires(W w, T t, std::string_view name,
+                            std::string basic_value,
                             typename W::OutputArrayType arr,
                             typename W::OutputObjectType obj,
                             typename W::OutputVarType var) {
@@ -19,29 +22,65 @@ concept IsWriter = requires(W w, T t, std::string name,
     /// 2) An OutputObjectType, which must contain key-value pairs.
     /// 3) An OutputVarType, which must be able to represent either
     ///    OutputArrayType, OutputObjectType or a basic type (bool, integral,
-    ///    floating point, std::string).
+    ///    floating point, std::string, std::string_view).
+    ///
+    /// Values are always added to their parent right away and in the order
+    /// in which they appear, so writers can emit them immediately.
+
+    /// Sets an empty array as the root element of the document.
+    { w.array_as_root() } -> std::same_as<typename W::OutputArrayType>;
+
+    /// Sets an empty object as the root element of the document.
+    { w.object_as_root() } -> std::same_as<typename W::OutputObjectType>;
+
+    /// Sets a null as the root element of the document.
+    { w.null_as_root() } -> std::same_as<typename W::OutputVarType>;
+
+    /// Sets a basic value (bool, numeric, string) as the root element of the
+    /// document.
+    { w.value_as_root(basic_value) } -> std::same_as<typename W::OutputVarType>;
+
+    /// Adds an empty array to an existing array and returns it.
+    { w.add_array_to_array(&arr) } -> std::same_as<typename W::OutputArrayType>;
+
+    /// Adds an empty array to an existing object and returns it.
+    {
+      w.add_array_to_object(name, &obj)
+      } -> std::same_as<typename W::OutputArrayType>;
+
+    /// Adds an empty object to an existing array and returns it.
+    {
+      w.add_object_to_array(&arr)
+      } -> std::same_as<typename W::OutputObjectType>;
 
-    /// Appends var to the end of arr, thus mutating it.
-    { w.add(var, &arr) } -> std::same_as<void>;
+    /// Adds an empty object to an existing object and returns it.
+    {
+      w.add_object_to_object(name, &obj)
+      } -> std::same_as<typename W::OutputObjectType>;
 
-    /// Returns an empty var (usually the NULL type).
-    { w.empty_var() } -> std::same_as<typename W::OutputVarType>;
+    /// Adds a basic value (bool, numeric, string) to an array.
+    {
+      w.add_value_to_array(basic_value, &arr)
+      } -> std::same_as<typename W::OutputVarType>;
 
-    /// Generates a var from a basic type (std::string, bool, floating point or
-    /// integral).
-    { w.from_basic_type(t) } -> std::same_as<typename W::OutputVarType>;
+    /// Adds a basic value (bool, numeric, string) to an existing object.
+    {
+      w.add_value_to_object(name, basic_value, &obj)
+      } -> std::same_as<typename W::OutputVarType>;
 
-    /// Generates a new, empty array.
-    { w.new_array() } -> std::same_as<typename W::OutputArrayType>;
+    /// Adds a null value to an array.
+    { w.add_null_to_array(&arr) } -> std::same_as<typename W::OutputVarType>;
 
-    /// Generates a new, empty object.
-    { w.new_object() } -> std::same_as<typename W::OutputObjectType>;
+    /// Adds a null value to an existing object.
+    {
+      w.add_null_to_object(name, &obj)
+      } -> std::same_as<typename W::OutputVarType>;
 
-    /// Determines whether the var is empty (the NULL type).
-    { w.is_empty(var) } -> std::same_as<bool>;
+    /// Signals that all elements of an array have been added.
+    { w.end_array(&arr) } -> std::same_as<void>;
 
-    /// Adds a new field to obj, thus mutating it.
-    { w.set_field(name, var, &obj) } -> std::same_as<void>;
+    /// Signals that all fields of an object have been added.
+    { w.end_object(&obj) } -> std::same_as<void>;
 };
 
 }  // namespace parsing
@@ -1,13 +1,22 @@
 #ifndef RFL_PARSING_MAPPARSER_HPP_
 #define RFL_PARSING_MAPPARSER_HPP_
 
-#include <stdexcept>
+#include <cstddef>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
+#include <utility>
 
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/internal/stats/Timer.hpp"
+#include "rfl/internal/strings/NumberString.hpp"
+#include "rfl/internal/strings/from_chars.hpp"
+#include "rfl/parsing/Parent.hpp"
 #include "rfl/parsing/Parser_base.hpp"
+#include "rfl/parsing/supports_object_size.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -22,100 +31,121 @@ struct MapParser {
   using OutputObjectType = typename W::OutputObjectType;
   using OutputVarType = typename W::OutputVarType;
 
+  using ParentType = Parent<W>;
+
   using KeyType = std::decay_t<typename MapType::value_type::first_type>;
   using ValueType = std::decay_t<typename MapType::value_type::second_type>;
 
   static Result<MapType> read(const R& _r, const InputVarType& _var) noexcept {
+    const auto timer = internal::stats::ReadTimer<MapType>();
     const auto to_map = [&](const auto& _obj) { return make_map(_r, _obj); };
     return _r.to_object(_var).and_then(to_map);
   }
 
-  static OutputVarType write(const W& _w, const MapType& _m) noexcept {
-    auto obj = _w.new_object();
+  template <class P>
+  static void write(const W& _w, const MapType& _m,
+                    const P& _parent) noexcept {
+    const auto timer = internal::stats::WriteTimer<MapType>();
+    auto obj = ParentType::add_object(_w, _parent);
     for (const auto& [k, v] : _m) {
-      auto parsed_val = Parser<R, W, std::decay_t<ValueType>>::write(_w, v);
       if constexpr (internal::has_reflection_type_v<KeyType>) {
         using ReflT = typename KeyType::ReflectionType;
 
         if constexpr (std::is_integral_v<ReflT> ||
                       std::is_floating_point_v<ReflT>) {
-          _w.set_field(std::to_string(k.reflection()), std::move(parsed_val),
-                       &obj);
+          const auto name = internal::strings::NumberString(k.reflection());
+          write_field(_w, name.view(), v, &obj);
         } else {
-          _w.set_field(k.reflection(), std::move(parsed_val), &obj);
+          const auto& name = k.reflection();
+          write_field(_w, name, v, &obj);
         }
 
       } else if constexpr (std::is_integral_v<KeyType> ||
                            std::is_floating_point_v<KeyType>) {
-        _w.set_field(std::to_string(k), std::move(parsed_val), &obj);
+        const auto name = internal::strings::NumberString(k);
+        write_field(_w, name.view(), v, &obj);
       } else {
-        _w.set_field(k, std::move(parsed_val), &obj);
+        write_field(_w, k, v, &obj);
       }
     }
-    return obj;
+    _w.end_object(&obj);
   }
 
  private:
+  static void write_field(const W& _w, const std::string_view& _name,
+                          const ValueType& _val,
+                          OutputObjectType* _obj) noexcept {
+    const auto new_parent = typename ParentType::Object{_name, _obj};
+    Parser<R, W, std::decay_t<ValueType>>::write(_w, _val, new_parent);
+  }
+
   template <class T>
-  static Result<T> key_to_numeric(auto& _pair) noexcept {
-    try {
-      if constexpr (std::is_integral_v<T>) {
-        return static_cast<T>(std::stoi(_pair.first));
-      } else if constexpr (std::is_floating_point_v<T>) {
-        return static_cast<T>(std::stod(_pair.first));
-      } else {
-        static_assert(always_false_v<T>, "Unsupported type");
-      }
-    } catch (std::exception& e) {
-      return Error(e.what());
+  static Result<T> key_to_numeric(const std::string_view& _key) noexcept {
+    static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>,
+                  "Unsupported type");
+    T value;
+    const auto [ptr, ec] = internal::strings::from_chars(
+        _key.data(), _key.data() + _key.size(), value);
+    if (ec != std::errc() || ptr != _key.data() + _key.size()) {
+      return Error("Could not convert key '" + std::string(_key) + "' to " +
+                   (std::is_integral_v<T> ? "an integer." : "a number."));
     }
+    return value;
   }
 
-  static Result<std::pair<KeyType, ValueType>> make_key(auto& _pair) noexcept {
-    const auto to_pair = [&](auto _key) {
-      return std::make_pair(KeyType(std::move(_key)), std::move(_pair.second));
-    };
-
+  static Result<KeyType> make_key(const std::string_view& _key) noexcept {
     if constexpr (std::is_integral_v<KeyType> ||
                   std::is_floating_point_v<KeyType>) {
-      return key_to_numeric<KeyType>(_pair).transform(to_pair);
+      return key_to_numeric<KeyType>(_key);
 
     } else if constexpr (internal::has_reflection_type_v<KeyType>) {
       using ReflT = typename KeyType::ReflectionType;
+      const auto to_key = [](auto _k) { return KeyType(std::move(_k)); };
 
       if constexpr (std::is_integral_v<ReflT> ||
                     std::is_floating_point_v<ReflT>) {
-        return key_to_numeric<ReflT>(_pair).transform(to_pair);
+        return key_to_numeric<ReflT>(_key).transform(to_key);
       } else {
-        return to_pair(_pair.first);
+        return to_key(ReflT(_key));
       }
 
     } else {
-      return std::move(_pair);
+      return KeyType(_key);
     }
   }
 
-  static std::pair<KeyType, ValueType> get_pair(const R& _r, auto& _pair) {
-    const auto to_pair = [&](ValueType&& _val) {
-      auto pair = std::make_pair(std::move(_pair.first), std::move(_val));
-      return make_key(pair);
-    };
-    return Parser<R, W, std::decay_t<ValueType>>::read(_r, _pair.second)
-        .and_then(to_pair)
-        .value();
-  }
+  /// Iterates through the object once and inserts the key-value pairs
+  /// directly. Like insert(...), try_emplace(...) keeps the first of any
+  /// duplicate keys.
+  static Result<MapType> make_map(const R& _r,
+                                  const InputObjectType& _obj) noexcept {
+    MapType map;
+
+    if constexpr (supports_object_size<R> &&
+                  requires(MapType m) { m.reserve(size_t()); }) {
+      map.reserve(_r.object_size(_obj));
+    }
 
-  static Result<MapType> make_map(const R& _r, const auto& _obj) noexcept {
-    auto m = _r.to_map(_obj);
-    MapType res;
-    try {
-      for (auto& p : m) {
-        res.insert(get_pair(_r, p));
+    const auto insert = [&](const std::string_view& _name,
+                            const InputVarType& _var) -> std::optional<Error> {
+      auto val = Parser<R, W, ValueType>::read(_r, _var);
+      if (!val) {
+        return std::move(*val.error());
+      }
+      auto key = make_key(_name);
+      if (!key) {
+        return std::move(*key.error());
       }
-    } catch (std::exception& e) {
-      return Error(e.what());
+      map.try_emplace(std::move(*key), std::move(*val));
+      return std::nullopt;
+    };
+
+    auto err = _r.read_object(insert, _obj);
+    if (err) {
+      return std::move(*err);
     }
-    return res;
+
+    return map;
   }
 };
 
@@ -1,16 +1,24 @@
 #ifndef RFL_PARSING_NAMEDTUPLEPARSER_HPP_
 #define RFL_PARSING_NAMEDTUPLEPARSER_HPP_
 
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
-#include <unordered_map>
+#include <vector>
 
 #include "rfl/NamedTuple.hpp"
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/internal/StringHashTable.hpp"
 #include "rfl/internal/is_basic_type.hpp"
-#include "rfl/internal/strings/replace_all.hpp"
+#include "rfl/parsing/Parent.hpp"
+#include "rfl/parsing/is_empty.hpp"
 #include "rfl/parsing/is_required.hpp"
+#include "rfl/parsing/supports_fail_fast.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -24,17 +32,15 @@ struct NamedTupleParser {
   using OutputObjectType = typename W::OutputObjectType;
   using OutputVarType = typename W::OutputVarType;
 
+  using ParentType = Parent<W>;
+
  public:
   /// Generates a NamedTuple from a JSON Object.
   static Result<NamedTuple<FieldTypes...>> read(
       const R& _r, const InputVarType& _var) noexcept {
-    const auto& indices = field_indices();
-    const auto fct = [&](const std::string_view& _str) -> std::int16_t {
-      const auto it = indices.find(_str);
-      return it != indices.end() ? it->second : static_cast<std::uint16_t>(-1);
-    };
     const auto to_fields_array = [&](auto _obj) {
-      return _r.template to_fields_array<sizeof...(FieldTypes)>(fct, _obj);
+      return _r.template to_fields_array<sizeof...(FieldTypes)>(
+          find_field_index, _obj);
     };
     const auto build = [&](auto _fields_vec) {
       return build_named_tuple_recursively(_r, _fields_vec);
@@ -42,12 +48,34 @@ struct NamedTupleParser {
     return _r.to_object(_var).transform(to_fields_array).and_then(build);
   }
 
-  /// Transforms a NamedTuple into a JSON object.
-  static OutputVarType write(const W& _w,
-                             const NamedTuple<FieldTypes...>& _tup) noexcept {
-    auto obj = _w.new_object();
+  /// Reads the values directly into the fields the view points to, which is
+  /// how structs are parsed in place. All of the FieldTypes must be
+  /// non-const pointers, as generated by internal::to_ptr_named_tuple(...).
+  static std::optional<Error> read_view(
+      const R& _r, const InputVarType& _var,
+      NamedTuple<FieldTypes...>* _view) noexcept {
+    const auto obj = _r.to_object(_var);
+    if (!obj) {
+      return obj.error();
+    }
+    const auto fields_arr =
+        _r.template to_fields_array<sizeof...(FieldTypes)>(find_field_index,
+                                                           *obj);
+    std::vector<Error> errors;
+    set_fields_recursively(_r, fields_arr, _view, &errors);
+    if (errors.size() == 0) {
+      return std::nullopt;
+    }
+    return to_single_error(std::move(errors));
+  }
+
+  /// Writes a NamedTuple as an object into its parent.
+  template <class P>
+  static void write(const W& _w, const NamedTuple<FieldTypes...>& _tup,
+                    const P& _parent) noexcept {
+    auto obj = ParentType::add_object(_w, _parent);
     build_object_recursively(_w, _tup, &obj);
-    return OutputVarType(obj);
+    _w.end_object(&obj);
   }
 
  private:
@@ -72,11 +100,10 @@ struct NamedTupleParser {
 
       if (!f) {
         if constexpr (is_required<ValueType, _ignore_empty_containers>()) {
-          const auto key = FieldType::name_.str();
           return collect_errors<i + 1>(
               _r, _fields_arr,
               std::vector<Error>(
-                  {Error("Field named '" + key + "' not found!")}));
+                  {Error::field_not_found(FieldType::name_.string_view())}));
         } else {
           return build_named_tuple_recursively(
               _r, _fields_arr, std::move(_args)..., FieldType(ValueType()));
@@ -98,26 +125,19 @@ struct NamedTupleParser {
   }
 
   /// If something went wrong, we want to collect all of the errors - it's
-  /// just good UX.
+  /// just good UX. Unless the reader is supposed to fail fast, in which case
+  /// the remaining fields are not parsed at all.
   template <int _i>
   static Error collect_errors(
       const R& _r,
       const std::array<std::optional<InputVarType>, sizeof...(FieldTypes)>&
           _fields_arr,
       std::vector<Error> _errors) noexcept {
+    if (fail_fast(_r)) {
+      return to_single_error(std::move(_errors));
+    }
     if constexpr (_i == sizeof...(FieldTypes)) {
-      if (_errors.size() == 1) {
-        return std::move(_errors[0]);
-      } else {
-        std::string msg =
-            "Found " + std::to_string(_errors.size()) + " errors:";
-        for (size_t i = 0; i < _errors.size(); ++i) {
-          msg += "\n" + std::to_string(i + 1) + ") " +
-                 internal::strings::replace_all(_errors.at(i).what(), "\n",
-                                                "\n    ");
-        }
-        return Error(msg);
-      }
+      return to_single_error(std::move(_errors));
     } else {
       using FieldType = typename std::tuple_element<
           _i, typename NamedTuple<FieldTypes...>::Fields>::type;
@@ -128,8 +148,8 @@ struct NamedTupleParser {
 
       if (!f) {
         if constexpr (is_required<ValueType, _ignore_empty_containers>()) {
-          const auto key = FieldType::name_.str();
-          _errors.emplace_back(Error("Field named '" + key + "' not found."));
+          _errors.emplace_back(
+              Error::field_not_found(FieldType::name_.string_view()));
         }
         return collect_errors<_i + 1>(_r, _fields_arr, std::move(_errors));
       }
@@ -146,6 +166,71 @@ struct NamedTupleParser {
     }
   }
 
+  /// Parses the fields one by one and assigns them to the values the view
+  /// points to. Errors are handled just like in collect_errors(...).
+  template <int _i = 0>
+  static void set_fields_recursively(
+      const R& _r,
+      const std::array<std::optional<InputVarType>, sizeof...(FieldTypes)>&
+          _fields_arr,
+      NamedTuple<FieldTypes...>* _view, std::vector<Error>* _errors) noexcept {
+    if constexpr (_i < sizeof...(FieldTypes)) {
+      using FieldType = typename std::tuple_element<
+          _i, typename NamedTuple<FieldTypes...>::Fields>::type;
+
+      using ValueType =
+          std::remove_cvref_t<std::remove_pointer_t<typename FieldType::Type>>;
+
+      auto* ptr = rfl::get<_i>(*_view);
+
+      const auto& f = std::get<_i>(_fields_arr);
+
+      if (!f) {
+        if constexpr (is_required<ValueType, _ignore_empty_containers>()) {
+          _errors->emplace_back(
+              Error::field_not_found(FieldType::name_.string_view()));
+        } else {
+          reset_field(ptr);
+        }
+      } else {
+        auto res = get_value<FieldType, ValueType>(_r, *f);
+        if (res) {
+          *ptr = std::move(*res);
+        } else {
+          _errors->emplace_back(std::move(*res.error()));
+        }
+      }
+
+      if (_errors->size() != 0 && fail_fast(_r)) {
+        return;
+      }
+
+      set_fields_recursively<_i + 1>(_r, _fields_arr, _view, _errors);
+    }
+  }
+
+  /// Resets a field that is missing from the input. Optional-like types are
+  /// reset instead of being assigned a default-constructed temporary, which
+  /// GCC flags with -Wmaybe-uninitialized.
+  template <class ValueType>
+  static void reset_field(ValueType* _ptr) noexcept {
+    if constexpr (requires(ValueType& _v) { _v.reset(); }) {
+      _ptr->reset();
+    } else {
+      *_ptr = ValueType();
+    }
+  }
+
+  /// If there is more than one error, they are combined into a single one -
+  /// it's just good UX.
+  static Error to_single_error(std::vector<Error> _errors) noexcept {
+    if (_errors.size() == 1) {
+      return std::move(_errors[0]);
+    } else {
+      return Error::multiple(std::move(_errors));
+    }
+  }
+
   /// Builds the object field by field.
   template <int _i = 0>
   static void build_object_recursively(const W& _w,
@@ -157,63 +242,55 @@ struct NamedTupleParser {
       using FieldType =
           typename std::tuple_element<_i, std::tuple<FieldTypes...>>::type;
       using ValueType = std::decay_t<typename FieldType::Type>;
-      auto value = Parser<R, W, ValueType>::write(_w, rfl::get<_i>(_tup));
-      const auto name = FieldType::name_.str();
+      const auto& value = rfl::get<_i>(_tup);
+      const auto new_parent =
+          typename ParentType::Object{FieldType::name_.string_view(), _ptr};
       if constexpr (!is_required<ValueType, _ignore_empty_containers>()) {
-        if (!_w.is_empty(value)) {
-          _w.set_field(name, value, _ptr);
+        if (!is_empty(value)) {
+          Parser<R, W, ValueType>::write(_w, value, new_parent);
         }
       } else {
-        _w.set_field(name, value, _ptr);
+        Parser<R, W, ValueType>::write(_w, value, new_parent);
       }
       return build_object_recursively<_i + 1>(_w, _tup, _ptr);
     }
   }
 
-  /// Uses a memoization pattern to retrieve the field indices.
-  /// There are some objects that we are likely to parse many times,
-  /// so we only calculate these indices once.
-  static const auto& field_indices() noexcept {
-    return field_indices_.value(set_field_indices<0>);
-  }
-
   /// Retrieves the value from the object. This is mainly needed to
   /// generate a better error message.
-  template <class FieldType>
+  template <class FieldType,
+            class ValueType = std::decay_t<typename FieldType::Type>>
   static auto get_value(const R& _r, const InputVarType _var) noexcept {
     static_assert(FieldType::name_ != internal::StringLiteral("xml_content") ||
-                      internal::is_basic_type_v<typename FieldType::Type>,
+                      internal::is_basic_type_v<ValueType>,
                   "xml_content must be a string, a boolean, a floating point "
                   "value or integral.");
-    const auto embellish_error = [&](const Error& _e) {
-      const auto key = FieldType::name_.str();
-      return Error("Failed to parse field '" + key + "': " + _e.what());
+    const auto embellish_error = [](Error&& _e) {
+      return Error::field_failed(FieldType::name_.string_view(), std::move(_e));
     };
-    using ValueType = std::decay_t<typename FieldType::Type>;
     return Parser<R, W, ValueType>::read(_r, _var).or_else(embellish_error);
   }
 
-  /// Builds the object field by field.
-  template <size_t _i = 0>
-  static void set_field_indices(
-      std::unordered_map<std::string_view, std::int16_t>*
-          _field_indices) noexcept {
-    if constexpr (_i >= sizeof...(FieldTypes)) {
-      return;
+  /// Whether parsing should stop at the first error.
+  static bool fail_fast(const R& _r) noexcept {
+    if constexpr (supports_fail_fast<R>) {
+      return _r.fail_fast();
     } else {
-      using FieldType =
-          typename std::tuple_element<_i, std::tuple<FieldTypes...>>::type;
-      const auto name = FieldType::name_.string_view();
-      (*_field_indices)[name] = static_cast<std::int16_t>(_i);
-      set_field_indices<_i + 1>(_field_indices);
+      return false;
     }
   }
 
- private:
-  /// Maps each of the field names to an index signifying their order.
-  static inline internal::Memoization<
-      std::unordered_map<std::string_view, std::int16_t>>
-      field_indices_;
+  /// Returns the index of the field or -1, if there is no such field.
+  static std::int16_t find_field_index(const std::string_view& _str) noexcept {
+    return static_cast<std::int16_t>(field_indices_.find(_str));
+  }
+
+  /// Maps each of the field names to an index signifying their order. This
+  /// is generated at compile time.
+  static constexpr internal::StringHashTable<sizeof...(FieldTypes)>
+      field_indices_ = internal::StringHashTable<sizeof...(FieldTypes)>(
+          std::array<std::string_view, sizeof...(FieldTypes)>(
+              {FieldTypes::name_.string_view()...}));
 };
 
 }  // namespace parsing
@@ -0,0 +1,157 @@
+#ifndef RFL_PARSING_PARALLELPARSER_HPP_
+#define RFL_PARSING_PARALLELPARSER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/internal/stats/Timer.hpp"
+#include "rfl/parsing/Parser_base.hpp"
+#include "rfl/parsing/supports_array_size.hpp"
+#include "rfl/parsing/supports_numeric_arrays.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Parses the elements of a std::vector concurrently. The array is iterated
+/// once to collect the elements, which are then split into contiguous
+/// chunks, one per thread. Every chunk is parsed into pre-sized slots, so
+/// the order of the elements is preserved. Every thread stops at its first
+/// error and the error of the first chunk that failed is returned, so the
+/// result is the same as if the elements had been parsed sequentially.
+///
+/// Any other type, as well as vectors that are read in bulk anyway, are
+/// passed on to Parser<R, W, T>.
+template <class R, class W, class T>
+requires AreReaderAndWriter<R, W, T>
+struct ParallelParser {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<T> read(const R& _r, const InputVarType& _var,
+                        const size_t _num_threads) noexcept {
+    return Parser<R, W, T>::read(_r, _var);
+  }
+};
+
+template <class R, class W, class T>
+requires AreReaderAndWriter<R, W, std::vector<T>>
+struct ParallelParser<R, W, std::vector<T>> {
+  using InputArrayType = typename R::InputArrayType;
+  using InputVarType = typename R::InputVarType;
+
+  using VecType = std::vector<T>;
+
+  /// Below this number of elements per thread, it is not worth starting
+  /// another thread.
+  static constexpr size_t min_chunk_size_ = 256;
+
+  static Result<VecType> read(const R& _r, const InputVarType& _var,
+                              const size_t _num_threads) noexcept {
+    if constexpr (std::is_same<T, bool>() || supports_numeric_arrays<R, T>) {
+      return Parser<R, W, VecType>::read(_r, _var);
+    } else {
+      const auto timer = internal::stats::ReadTimer<VecType>();
+      const auto to_vec = [&](const InputArrayType& _arr) {
+        return read_elements(_r, _arr, _num_threads);
+      };
+      return _r.to_array(_var).and_then(to_vec);
+    }
+  }
+
+ private:
+  /// If T cannot be default-constructed and assigned to, the slots are
+  /// optionals.
+  using SlotType = std::conditional_t<std::is_default_constructible_v<T> &&
+                                          std::is_move_assignable_v<T>,
+                                      T, std::optional<T>>;
+
+  static Result<VecType> read_elements(const R& _r,
+                                       const InputArrayType& _arr,
+                                       const size_t _num_threads) noexcept {
+    std::vector<InputVarType> vars;
+    if constexpr (supports_array_size<R>) {
+      vars.reserve(_r.array_size(_arr));
+    }
+    const auto collect = [&](const InputVarType& _v) -> std::optional<Error> {
+      vars.push_back(_v);
+      return std::nullopt;
+    };
+    const auto err = _r.read_array(collect, _arr);
+    if (err) {
+      return *err;
+    }
+
+    const size_t num_chunks = std::clamp<size_t>(
+        vars.size() / min_chunk_size_, 1, resolve_num_threads(_num_threads));
+
+    std::vector<SlotType> slots(vars.size());
+
+    std::vector<std::optional<Error>> errors(num_chunks);
+
+    const auto parse_chunk = [&](const size_t _chunk) {
+      const size_t begin = vars.size() * _chunk / num_chunks;
+      const size_t end = vars.size() * (_chunk + 1) / num_chunks;
+      for (size_t i = begin; i < end; ++i) {
+        auto res = Parser<R, W, T>::read(_r, vars[i]);
+        if (!res) {
+          errors[_chunk] = std::move(*res.error());
+          return;
+        }
+        slots[i] = std::move(*res);
+      }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_chunks - 1);
+    for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+      try {
+        threads.emplace_back(parse_chunk, chunk);
+      } catch (std::exception&) {
+        // If no more threads can be started, the calling thread takes over.
+        parse_chunk(chunk);
+      }
+    }
+    parse_chunk(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    for (auto& e : errors) {
+      if (e) {
+        return std::move(*e);
+      }
+    }
+
+    return to_vec(std::move(slots));
+  }
+
+  static size_t resolve_num_threads(const size_t _num_threads) noexcept {
+    if (_num_threads != 0) {
+      return _num_threads;
+    }
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  }
+
+  static VecType to_vec(std::vector<SlotType>&& _slots) {
+    if constexpr (std::is_same<SlotType, T>()) {
+      return std::move(_slots);
+    } else {
+      VecType vec;
+      vec.reserve(_slots.size());
+      for (auto& slot : _slots) {
+        vec.emplace_back(std::move(*slot));
+      }
+      return vec;
+    }
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -5,6 +5,7 @@
 #include "rfl/parsing/Parser_base.hpp"
 #include "rfl/parsing/Parser_box.hpp"
 #include "rfl/parsing/Parser_default.hpp"
+#include "rfl/parsing/Parser_literal.hpp"
 #include "rfl/parsing/Parser_map_like.hpp"
 #include "rfl/parsing/Parser_named_tuple.hpp"
 #include "rfl/parsing/Parser_optional.hpp"
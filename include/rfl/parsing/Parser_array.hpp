@@ -2,12 +2,18 @@
 #define RFL_PARSING_PARSER_ARRAY_HPP_
 
 #include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
 #include <type_traits>
-#include <vector>
+#include <utility>
 
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/parsing/Parent.hpp"
 #include "rfl/parsing/Parser_base.hpp"
+#include "rfl/parsing/supports_array_size.hpp"
+#include "rfl/parsing/supports_numeric_arrays.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -21,61 +27,110 @@ struct Parser<R, W, std::array<T, _size>> {
   using OutputArrayType = typename W::OutputArrayType;
   using OutputVarType = typename W::OutputVarType;
 
+  using ParentType = Parent<W>;
+
+  using StagingType =
+      std::conditional_t<std::is_default_constructible_v<T>,
+                         std::array<T, _size>,
+                         std::array<std::optional<T>, _size>>;
+
   static Result<std::array<T, _size>> read(const R& _r,
                                            const InputVarType& _var) noexcept {
-    const auto to_vec = [&](const auto& _arr) { return _r.to_vec(_arr); };
+    if constexpr (supports_numeric_arrays<R, T>) {
+      return read_numbers(_r, _var);
+    } else {
+      return read_elements(_r, _var);
+    }
+  }
 
-    const auto check_size = [](auto _vec) -> Result<std::vector<InputVarType>> {
-      if (_vec.size() != _size) {
-        return Error("Expected " + std::to_string(_size) + " fields, got " +
-                     std::to_string(_vec.size()) + ".");
+  template <class P>
+  static void write(const W& _w, const std::array<T, _size>& _arr,
+                    const P& _parent) noexcept {
+    auto arr = ParentType::add_array(_w, _parent);
+    const auto new_parent = typename ParentType::Array{&arr};
+    for (auto it = _arr.begin(); it != _arr.end(); ++it) {
+      Parser<R, W, std::decay_t<T>>::write(_w, *it, new_parent);
+    }
+    _w.end_array(&arr);
+  }
+
+ private:
+  /// Arrays of numbers are filled in a single pass, if the reader supports
+  /// it.
+  static Result<std::array<T, _size>> read_numbers(
+      const R& _r, const InputVarType& _var) noexcept {
+    std::array<T, _size> arr;
+    const auto get_buffer = [&](const size_t _n) -> Result<T*> {
+      if (_n != _size) {
+        return size_error(_n);
       }
-      return std::move(_vec);
+      return arr.data();
     };
+    auto err = _r.template read_numbers<T>(_var, get_buffer);
+    if (err) {
+      return std::move(*err);
+    }
+    return arr;
+  }
+
+  /// Parses the elements directly into the array. If T is not default
+  /// constructible, they are staged in std::optional first. Readers that
+  /// cannot tell the size of an array up front are checked while parsing.
+  static Result<std::array<T, _size>> read_elements(
+      const R& _r, const InputVarType& _var) noexcept {
+    auto arr = _r.to_array(_var);
+    if (!arr) {
+      return std::move(*arr.error());
+    }
+
+    if constexpr (supports_array_size<R>) {
+      const auto size = _r.array_size(*arr);
+      if (size != _size) {
+        return size_error(size);
+      }
+    }
 
-    const auto extract = [&_r](auto _vec) {
-      return extract_field_by_field(_r, std::move(_vec));
+    StagingType staging;
+    size_t i = 0;
+    const auto assign = [&](const InputVarType& _v) -> std::optional<Error> {
+      // Surplus elements are only counted, so the error can report them.
+      if (i >= _size) {
+        ++i;
+        return std::nullopt;
+      }
+      auto res = Parser<R, W, T>::read(_r, _v);
+      if (!res) {
+        return std::move(*res.error());
+      }
+      staging[i++] = std::move(*res);
+      return std::nullopt;
     };
 
-    return _r.to_array(_var)
-        .transform(to_vec)
-        .and_then(check_size)
-        .and_then(extract);
-  }
+    auto err = _r.read_array(assign, *arr);
+    if (err) {
+      return std::move(*err);
+    }
 
-  static OutputVarType write(const W& _w,
-                             const std::array<T, _size>& _arr) noexcept {
-    auto arr = _w.new_array();
-    for (auto it = _arr.begin(); it != _arr.end(); ++it) {
-      _w.add(Parser<R, W, std::decay_t<T>>::write(_w, *it), &arr);
+    if (i != _size) {
+      return size_error(i);
     }
-    return OutputVarType(arr);
-  }
 
- private:
-  /// Extracts values from the array, field by field.
-  template <class... AlreadyExtracted>
-  static Result<std::array<T, _size>> extract_field_by_field(
-      const R& _r, std::vector<InputVarType> _vec,
-      AlreadyExtracted&&... _already_extracted) noexcept {
-    constexpr size_t i = sizeof...(AlreadyExtracted);
-    if constexpr (i == _size) {
-      return std::array<T, _size>({std::move(_already_extracted)...});
+    if constexpr (std::is_default_constructible_v<T>) {
+      return std::move(staging);
     } else {
-      const auto extract_next = [&](auto&& new_entry) {
-        return extract_field_by_field(_r, std::move(_vec),
-                                      std::move(_already_extracted)...,
-                                      std::move(new_entry));
-      };
-      return extract_single_field<i>(_r, _vec).and_then(extract_next);
+      return unwrap(std::move(staging), std::make_index_sequence<_size>());
     }
   }
 
-  /// Extracts a single field from a JSON.
-  template <int _i>
-  static auto extract_single_field(
-      const R& _r, const std::vector<InputVarType>& _vec) noexcept {
-    return Parser<R, W, T>::read(_r, _vec[_i]);
+  static Error size_error(const size_t _got) noexcept {
+    return Error("Expected " + std::to_string(_size) + " fields, got " +
+                 std::to_string(_got) + ".");
+  }
+
+  template <size_t... _is>
+  static std::array<T, _size> unwrap(StagingType&& _staging,
+                                     std::index_sequence<_is...>) noexcept {
+    return std::array<T, _size>({std::move(*_staging[_is])...});
   }
 };
 
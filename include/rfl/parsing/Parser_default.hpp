@@ -3,7 +3,9 @@
 
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 
+#include "rfl/NamedTuple.hpp"
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
 #include "rfl/from_named_tuple.hpp"
@@ -12,10 +14,13 @@
 #include "rfl/internal/has_reflection_type_v.hpp"
 #include "rfl/internal/is_attribute.hpp"
 #include "rfl/internal/is_basic_type.hpp"
+#include "rfl/internal/stats/Timer.hpp"
 #include "rfl/internal/to_ptr_named_tuple.hpp"
 #include "rfl/parsing/AreReaderAndWriter.hpp"
+#include "rfl/parsing/Parent.hpp"
 #include "rfl/parsing/Parser_base.hpp"
 #include "rfl/parsing/supports_attributes.hpp"
+#include "rfl/parsing/supports_string_views.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -27,8 +32,11 @@ struct Parser {
   using InputVarType = typename R::InputVarType;
   using OutputVarType = typename W::OutputVarType;
 
+  using ParentType = Parent<W>;
+
   /// Expresses the variables as type T.
   static Result<T> read(const R& _r, const InputVarType& _var) noexcept {
+    const auto timer = internal::stats::ReadTimer<T>();
     if constexpr (R::template has_custom_constructor<T>) {
       return _r.template use_custom_constructor<T>(_var);
     } else {
@@ -43,19 +51,29 @@ struct Parser {
         };
         return Parser<R, W, ReflectionType>::read(_r, _var).and_then(wrap_in_t);
       } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>) {
-        using NamedTupleType = named_tuple_t<T>;
-        const auto to_struct = [](NamedTupleType&& _n) -> Result<T> {
-          try {
-            return from_named_tuple<T>(std::move(_n));
-          } catch (std::exception& e) {
-            return Error(e.what());
-          }
-        };
-        return Parser<R, W, NamedTupleType>::read(_r, _var).and_then(to_struct);
+        if constexpr (is_readable_in_place()) {
+          return read_in_place(_r, _var);
+        } else {
+          using NamedTupleType = named_tuple_t<T>;
+          const auto to_struct = [](NamedTupleType&& _n) -> Result<T> {
+            try {
+              return from_named_tuple<T>(std::move(_n));
+            } catch (std::exception& e) {
+              return Error(e.what());
+            }
+          };
+          return Parser<R, W, NamedTupleType>::read(_r, _var).and_then(
+              to_struct);
+        }
       } else if constexpr (std::is_enum_v<T>) {
         using StringConverter = internal::enums::StringConverter<T>;
-        return _r.template to_basic_type<std::string>(_var).and_then(
-            StringConverter::string_to_enum);
+        if constexpr (supports_string_views<R>) {
+          return _r.to_string_view(_var).and_then(
+              StringConverter::string_to_enum);
+        } else {
+          return _r.template to_basic_type<std::string>(_var).and_then(
+              StringConverter::string_to_enum);
+        }
       } else if constexpr (internal::is_basic_type_v<T>) {
         return _r.template to_basic_type<std::decay_t<T>>(_var);
       } else {
@@ -68,28 +86,43 @@ struct Parser {
     }
   }
 
-  /// Converts the variable to a JSON type.
-  static auto write(const W& _w, const T& _var) noexcept {
+  /// Writes the variable into its parent.
+  template <class P>
+  static void write(const W& _w, const T& _var, const P& _parent) noexcept {
+    const auto timer = internal::stats::WriteTimer<T>();
     if constexpr (supports_attributes<W> && internal::is_attribute_v<T>) {
-      return _w.from_basic_type(resolve_reflection_type(_var), true);
+      if constexpr (std::is_same<P, typename ParentType::Object>()) {
+        const auto attribute =
+            typename ParentType::Object{.name_ = _parent.name_,
+                                        .obj_ = _parent.obj_,
+                                        .is_attribute_ = true};
+        ParentType::add_value(_w, resolve_reflection_type(_var), attribute);
+      } else {
+        ParentType::add_value(_w, resolve_reflection_type(_var), _parent);
+      }
     } else if constexpr (internal::has_reflection_type_v<T>) {
       using ReflectionType = std::decay_t<typename T::ReflectionType>;
       if constexpr (internal::has_reflection_method_v<T>) {
-        return Parser<R, W, ReflectionType>::write(_w, _var.reflection());
+        Parser<R, W, ReflectionType>::write(_w, _var.reflection(), _parent);
       } else {
         const auto& [r] = _var;
-        return Parser<R, W, ReflectionType>::write(_w, r);
+        Parser<R, W, ReflectionType>::write(_w, r, _parent);
       }
     } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>) {
       const auto ptr_named_tuple = internal::to_ptr_named_tuple(_var);
       using PtrNamedTupleType = std::decay_t<decltype(ptr_named_tuple)>;
-      return Parser<R, W, PtrNamedTupleType>::write(_w, ptr_named_tuple);
+      Parser<R, W, PtrNamedTupleType>::write(_w, ptr_named_tuple, _parent);
     } else if constexpr (std::is_enum_v<T>) {
       using StringConverter = internal::enums::StringConverter<T>;
-      const auto str = StringConverter::enum_to_string(_var);
-      return _w.from_basic_type(str);
+      const auto name = StringConverter::enum_to_string_view(_var);
+      if (name) {
+        ParentType::add_value(_w, *name, _parent);
+      } else {
+        const auto str = StringConverter::enum_to_string(_var);
+        ParentType::add_value(_w, str, _parent);
+      }
     } else if constexpr (internal::is_basic_type_v<T>) {
-      return _w.from_basic_type(_var);
+      ParentType::add_value(_w, _var, _parent);
     } else {
       static_assert(always_false_v<T>,
                     "Unsupported type. Please refer to the sections on custom "
@@ -111,6 +144,41 @@ struct Parser {
       return _var;
     }
   }
+
+ private:
+  /// Structs are parsed in place, if they can be default-constructed without
+  /// any side effects and all of their fields can be assigned to. Otherwise,
+  /// they are parsed into a named tuple first.
+  static consteval bool is_readable_in_place() {
+    if constexpr (!std::is_nothrow_default_constructible_v<T>) {
+      return false;
+    } else {
+      using ViewType =
+          decltype(internal::to_ptr_named_tuple(std::declval<T&>()));
+      return all_fields_assignable(static_cast<ViewType*>(nullptr));
+    }
+  }
+
+  template <class... FieldTypes>
+  static consteval bool all_fields_assignable(NamedTuple<FieldTypes...>*) {
+    return (std::is_move_assignable_v<
+                std::remove_pointer_t<typename FieldTypes::Type>> &&
+            ...);
+  }
+
+  /// Parses the fields directly into a default-constructed struct, which
+  /// avoids moving every value through the named tuple.
+  static Result<T> read_in_place(const R& _r,
+                                 const InputVarType& _var) noexcept {
+    T t{};
+    auto view = internal::to_ptr_named_tuple(t);
+    using ViewType = std::decay_t<decltype(view)>;
+    const auto err = Parser<R, W, ViewType>::read_view(_r, _var, &view);
+    if (err) {
+      return *err;
+    }
+    return t;
+  }
 };
 
 }  // namespace parsing
@@ -0,0 +1,49 @@
+#ifndef RFL_PARSING_PARSER_LITERAL_HPP_
+#define RFL_PARSING_PARSER_LITERAL_HPP_
+
+#include <string>
+#include <string_view>
+
+#include "rfl/Literal.hpp"
+#include "rfl/Result.hpp"
+#include "rfl/internal/StringLiteral.hpp"
+#include "rfl/parsing/Parent.hpp"
+#include "rfl/parsing/Parser_base.hpp"
+#include "rfl/parsing/supports_string_views.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Literals are looked up directly in their compile-time table, without
+/// copying the string first, if the reader supports that.
+template <class R, class W, internal::StringLiteral... _fields>
+requires AreReaderAndWriter<R, W, Literal<_fields...>>
+struct Parser<R, W, Literal<_fields...>> {
+  using InputVarType = typename R::InputVarType;
+  using OutputVarType = typename W::OutputVarType;
+
+  using ParentType = Parent<W>;
+
+  static Result<Literal<_fields...>> read(const R& _r,
+                                          const InputVarType& _var) noexcept {
+    const auto to_literal = [](const auto& _str) {
+      return Literal<_fields...>::from_string(_str);
+    };
+    if constexpr (supports_string_views<R>) {
+      return _r.to_string_view(_var).and_then(to_literal);
+    } else {
+      return _r.template to_basic_type<std::string>(_var).and_then(to_literal);
+    }
+  }
+
+  template <class P>
+  static void write(const W& _w, const Literal<_fields...>& _literal,
+                    const P& _parent) noexcept {
+    ParentType::add_value(_w, _literal.name_view(), _parent);
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef RFL_PARSING_PARSER_MAP_LIKE_HPP_
 #define RFL_PARSING_PARSER_MAP_LIKE_HPP_
 
+#include <functional>
 #include <map>
 #include <stdexcept>
 #include <string>
@@ -27,6 +28,22 @@ struct Parser<R, W, std::unordered_map<std::string, T>>
     : public MapParser<R, W, std::unordered_map<std::string, T>> {
 };
 
+/// Maps with transparent comparison, which allow lookups using
+/// std::string_view without constructing a std::string.
+template <class R, class W, class T>
+requires AreReaderAndWriter<R, W, std::map<std::string, T, std::less<>>>
+struct Parser<R, W, std::map<std::string, T, std::less<>>>
+    : public MapParser<R, W, std::map<std::string, T, std::less<>>> {
+};
+
+template <class R, class W, class T, class Hash>
+requires AreReaderAndWriter<
+    R, W, std::unordered_map<std::string, T, Hash, std::equal_to<>>>
+struct Parser<R, W, std::unordered_map<std::string, T, Hash, std::equal_to<>>>
+    : public MapParser<
+          R, W, std::unordered_map<std::string, T, Hash, std::equal_to<>>> {
+};
+
 }  // namespace parsing
 }  // namespace rfl
 
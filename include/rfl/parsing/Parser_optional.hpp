@@ -6,6 +6,7 @@
 
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/parsing/Parent.hpp"
 #include "rfl/parsing/Parser_base.hpp"
 
 namespace rfl {
@@ -17,6 +18,8 @@ struct Parser<R, W, std::optional<T>> {
   using InputVarType = typename R::InputVarType;
   using OutputVarType = typename W::OutputVarType;
 
+  using ParentType = Parent<W>;
+
   static Result<std::optional<T>> read(const R& _r,
                                        const InputVarType& _var) noexcept {
     if (_r.is_empty(_var)) {
@@ -26,11 +29,14 @@ struct Parser<R, W, std::optional<T>> {
     return Parser<R, W, std::decay_t<T>>::read(_r, _var).transform(to_opt);
   }
 
-  static OutputVarType write(const W& _w, const std::optional<T>& _o) noexcept {
+  template <class P>
+  static void write(const W& _w, const std::optional<T>& _o,
+                    const P& _parent) noexcept {
     if (!_o) {
-      return _w.empty_var();
+      ParentType::add_null(_w, _parent);
+      return;
     }
-    return Parser<R, W, std::decay_t<T>>::write(_w, *_o);
+    Parser<R, W, std::decay_t<T>>::write(_w, *_o, _parent);
   }
 };
 
@@ -24,8 +24,10 @@ struct Parser<R, W, Ref<T>> {
   }
 
   /// Expresses the variable a a JSON.
-  static OutputVarType write(const W& _w, const Ref<T>& _ref) noexcept {
-    return Parser<R, W, std::decay_t<T>>::write(_w, *_ref);
+  template <class P>
+  static void write(const W& _w, const Ref<T>& _ref,
+                    const P& _parent) noexcept {
+    Parser<R, W, std::decay_t<T>>::write(_w, *_ref, _parent);
   }
 };
 
@@ -39,17 +39,15 @@ struct Parser<R, W, Result<T>> {
         Parser<R, W, VariantType>::read(_r, _var).transform(to_res));
   }
 
-  static OutputVarType write(const W& _w, const Result<T>& _r) noexcept {
-    const auto write_t = [&](const auto& _t) -> OutputVarType {
-      return Parser<R, W, std::decay_t<T>>::write(_w, _t);
-    };
-
-    const auto write_err = [&](const auto& _err) -> OutputVarType {
-      return Parser<R, W, ErrorType>::write(
-          _w, ErrorType(make_field<"error">(_err.what())));
-    };
-
-    return *_r.transform(write_t).or_else(write_err);
+  template <class P>
+  static void write(const W& _w, const Result<T>& _r,
+                    const P& _parent) noexcept {
+    if (_r) {
+      Parser<R, W, std::decay_t<T>>::write(_w, _r.value(), _parent);
+    } else {
+      Parser<R, W, ErrorType>::write(
+          _w, ErrorType(make_field<"error">(_r.error()->what())), _parent);
+    }
   }
 };
 
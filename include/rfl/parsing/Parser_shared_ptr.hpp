@@ -6,6 +6,7 @@
 
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/parsing/Parent.hpp"
 #include "rfl/parsing/Parser_base.hpp"
 
 namespace rfl {
@@ -17,6 +18,8 @@ struct Parser<R, W, std::shared_ptr<T>> {
   using InputVarType = typename R::InputVarType;
   using OutputVarType = typename W::OutputVarType;
 
+  using ParentType = Parent<W>;
+
   /// Expresses the variables as type T.
   static Result<std::shared_ptr<T>> read(const R& _r,
                                          const InputVarType& _var) noexcept {
@@ -30,12 +33,14 @@ struct Parser<R, W, std::shared_ptr<T>> {
   }
 
   /// Expresses the variable a a JSON.
-  static OutputVarType write(const W& _w,
-                             const std::shared_ptr<T>& _s) noexcept {
+  template <class P>
+  static void write(const W& _w, const std::shared_ptr<T>& _s,
+                    const P& _parent) noexcept {
     if (!_s) {
-      return _w.empty_var();
+      ParentType::add_null(_w, _parent);
+      return;
     }
-    return Parser<R, W, std::decay_t<T>>::write(_w, *_s);
+    Parser<R, W, std::decay_t<T>>::write(_w, *_s, _parent);
   }
 };
 
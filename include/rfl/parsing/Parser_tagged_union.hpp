@@ -1,13 +1,24 @@
 #ifndef RFL_PARSING_PARSER_TAGGED_UNION_HPP_
 #define RFL_PARSING_PARSER_TAGGED_UNION_HPP_
 
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "rfl/Result.hpp"
 #include "rfl/TaggedUnion.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/internal/StringHashTable.hpp"
+#include "rfl/internal/stats/Timer.hpp"
+#include "rfl/internal/tag_t.hpp"
 #include "rfl/parsing/Parser_base.hpp"
 #include "rfl/parsing/TaggedUnionWrapper.hpp"
+#include "rfl/parsing/supports_string_views.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -17,7 +28,8 @@ template <class R, class W, internal::StringLiteral _discriminator,
 requires AreReaderAndWriter<R, W,
                             TaggedUnion<_discriminator, AlternativeTypes...>>
 struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>> {
-  using ResultType = Result<TaggedUnion<_discriminator, AlternativeTypes...>>;
+  using TaggedUnionType = TaggedUnion<_discriminator, AlternativeTypes...>;
+  using ResultType = Result<TaggedUnionType>;
 
  public:
   using InputObjectType = typename R::InputObjectType;
@@ -27,102 +39,282 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>> {
   using OutputVarType = typename W::OutputVarType;
 
   static ResultType read(const R& _r, const InputVarType& _var) noexcept {
+    const auto timer = internal::stats::ReadTimer<TaggedUnionType>();
+
     const auto get_disc = [&_r](auto _obj) {
       return get_discriminator(_r, _obj);
     };
 
-    const auto to_result = [&_r, _var](const std::string& _disc_value) {
+    const auto to_result = [&_r, _var](const auto& _disc_value) {
       return find_matching_alternative(_r, _disc_value, _var);
     };
 
     return _r.to_object(_var).and_then(get_disc).and_then(to_result);
   }
 
-  static OutputVarType write(
-      const W& _w, const TaggedUnion<_discriminator, AlternativeTypes...>&
-                       _tagged_union) noexcept {
-    const auto handle = [&](const auto& _val) -> OutputVarType {
-      return write_wrapped(_w, _val);
+  template <class P>
+  static void write(
+      const W& _w,
+      const TaggedUnion<_discriminator, AlternativeTypes...>& _tagged_union,
+      const P& _parent) noexcept {
+    const auto timer = internal::stats::WriteTimer<TaggedUnionType>();
+    const auto handle = [&](const auto& _val) {
+      write_wrapped(_w, _val, _parent);
     };
-    return std::visit(handle, _tagged_union.variant_);
+    std::visit(handle, _tagged_union.variant_);
   }
 
  private:
-  template <int _i = 0>
+  /// The discriminator is only compared to the tags and then discarded, so
+  /// it is not copied, if the reader supports that.
+  using DiscriminatorType =
+      std::conditional_t<supports_string_views<R>, std::string_view,
+                         std::string>;
+
+  using ReadFunctionType = ResultType (*)(const R&, const size_t,
+                                          const InputVarType&) noexcept;
+
+  /// Looks up the alternative matching the discriminator in a table that is
+  /// generated at compile time, so the cost does not depend on the number of
+  /// alternatives.
   static ResultType find_matching_alternative(
-      const R& _r, const std::string& _disc_value,
+      const R& _r, const std::string_view& _disc_value,
       const InputVarType& _var) noexcept {
-    if constexpr (_i == sizeof...(AlternativeTypes)) {
-      return Error("Could not parse tagged union, could not match " +
-                   _discriminator.str() + " '" + _disc_value + "'.");
-    } else {
-      using AlternativeType = std::decay_t<
-          std::variant_alternative_t<_i, std::variant<AlternativeTypes...>>>;
-
-      if (contains_disc_value<AlternativeType>(_disc_value)) {
-        const auto to_tagged_union = [](auto&& _val) {
-          return TaggedUnion<_discriminator, AlternativeTypes...>(
-              std::move(_val));
-        };
-
-        const auto embellish_error = [&](Error&& _e) {
-          return Error(
-              "Could not parse tagged union with "
-              "discrimininator " +
-              _discriminator.str() + " '" + _disc_value + "': " + _e.what());
-        };
-
-        return Parser<R, W, AlternativeType>::read(_r, _var)
-            .transform(to_tagged_union)
-            .or_else(embellish_error);
-
-      } else {
-        return find_matching_alternative<_i + 1>(_r, _disc_value, _var);
-      }
+    const auto ix = tags_.find(_disc_value);
+    if (ix == -1) {
+      // The value points into the input, so it has to be copied.
+      return Error::with_context(no_match_message_.view(),
+                                 Error(std::string(_disc_value) + "'."));
     }
+    return read_functions_[alternative_indices_[ix]](_r, ix, _var);
+  }
+
+  /// Parses the alternative at position _i. _tag_ix is the position of the
+  /// tag that matched.
+  template <int _i>
+  static ResultType read_alternative(const R& _r, const size_t _tag_ix,
+                                     const InputVarType& _var) noexcept {
+    using AlternativeType = std::decay_t<
+        std::variant_alternative_t<_i, std::variant<AlternativeTypes...>>>;
+
+    const auto to_tagged_union = [](auto&& _val) {
+      return TaggedUnion<_discriminator, AlternativeTypes...>(std::move(_val));
+    };
+
+    const auto embellish_error = [&](Error&& _e) {
+      return Error::with_context(alternative_failed_messages_[_tag_ix],
+                                 std::move(_e));
+    };
+
+    return Parser<R, W, AlternativeType>::read(_r, _var)
+        .transform(to_tagged_union)
+        .or_else(embellish_error);
   }
 
-  /// Retrieves the discriminator.
-  static Result<std::string> get_discriminator(
+  /// Retrieves the discriminator. The name of the field is passed as a
+  /// std::string_view, if the reader supports that.
+  static Result<DiscriminatorType> get_discriminator(
       const R& _r, const InputObjectType& _obj) noexcept {
-    const auto embellish_error = [](const auto& _err) {
-      return Error("Could not parse tagged union: Could not find field '" +
-                   _discriminator.str() +
-                   "' or type of field was not a string.");
+    const auto embellish_error = [](const auto&) {
+      return Error::from_static(missing_discriminator_message_.view());
     };
 
     const auto to_type = [&_r](auto _var) {
-      return _r.template to_basic_type<std::string>(_var);
+      if constexpr (supports_string_views<R>) {
+        return _r.to_string_view(_var);
+      } else {
+        return _r.template to_basic_type<std::string>(_var);
+      }
     };
 
-    return _r.get_field(_discriminator.str(), _obj)
-        .and_then(to_type)
-        .or_else(embellish_error);
+    if constexpr (requires { _r.get_field(std::string_view(), _obj); }) {
+      return _r.get_field(_discriminator.string_view(), _obj)
+          .and_then(to_type)
+          .or_else(embellish_error);
+    } else {
+      return _r.get_field(_discriminator.str(), _obj)
+          .and_then(to_type)
+          .or_else(embellish_error);
+    }
+  }
+
+  /// A string that is assembled at compile time, so the error messages can
+  /// be referred to by errors without being copied.
+  template <size_t _size>
+  struct StaticString {
+    constexpr std::string_view view() const noexcept {
+      return std::string_view(chars_.data(), _size);
+    }
+    std::array<char, _size> chars_;
+  };
+
+  /// Concatenates _parts, whose lengths must add up to _size.
+  template <size_t _size>
+  static constexpr StaticString<_size> concat(
+      const std::initializer_list<std::string_view> _parts) {
+    StaticString<_size> str{};
+    size_t i = 0;
+    for (const auto& part : _parts) {
+      for (const char c : part) {
+        str.chars_[i++] = c;
+      }
+    }
+    return str;
+  }
+
+  /// All of the tags that the alternatives accept, in the order of the
+  /// alternatives. A tag that has already been accepted by an earlier
+  /// alternative is left out, because the first match wins.
+  static constexpr auto all_tags() {
+    std::array<std::string_view, num_tags_with_duplicates_> tags;
+    std::array<size_t, num_tags_with_duplicates_> alternative_indices;
+    size_t n = 0;
+    size_t alternative_ix = 0;
+    const auto append = [&](const auto& _tags) {
+      for (const auto& tag : _tags) {
+        bool is_new = true;
+        for (size_t j = 0; j < n; ++j) {
+          is_new = is_new && tags[j] != tag;
+        }
+        if (is_new) {
+          tags[n] = tag;
+          alternative_indices[n] = alternative_ix;
+          ++n;
+        }
+      }
+      ++alternative_ix;
+    };
+    (append(tags_of<AlternativeTypes>()), ...);
+    return std::make_tuple(tags, alternative_indices, n);
   }
 
-  /// Determines whether the discriminating literal contains the value
-  /// retrieved from the object.
   template <class T>
-  static inline bool contains_disc_value(
-      const std::string& _disc_value) noexcept {
-    return internal::tag_t<T>::contains(_disc_value);
+  static constexpr auto tags_of() {
+    return literal_strings(static_cast<internal::tag_t<T>*>(nullptr));
+  }
+
+  template <internal::StringLiteral... _tags>
+  static constexpr auto literal_strings(Literal<_tags...>*) {
+    return std::array<std::string_view, sizeof...(_tags)>(
+        {_tags.string_view()...});
   }
 
+  template <size_t... _is>
+  static constexpr auto make_read_functions(std::index_sequence<_is...>) {
+    return std::array<ReadFunctionType, sizeof...(_is)>(
+        {&read_alternative<_is>...});
+  }
+
+  static constexpr size_t num_tags_with_duplicates_ =
+      (tags_of<AlternativeTypes>().size() + ... + 0);
+
+  static constexpr size_t num_tags_ = std::get<2>(all_tags());
+
+  /// Maps the tags to their position in alternative_indices_.
+  static constexpr internal::StringHashTable<num_tags_> tags_ = [] {
+    const auto tags = std::get<0>(all_tags());
+    std::array<std::string_view, num_tags_> unique_tags;
+    for (size_t i = 0; i < num_tags_; ++i) {
+      unique_tags[i] = tags[i];
+    }
+    return unique_tags;
+  }();
+
+  /// The index of the alternative each tag belongs to.
+  static constexpr auto alternative_indices_ = [] {
+    const auto alternative_indices = std::get<1>(all_tags());
+    std::array<size_t, num_tags_> indices;
+    for (size_t i = 0; i < num_tags_; ++i) {
+      indices[i] = alternative_indices[i];
+    }
+    return indices;
+  }();
+
+  static constexpr std::string_view no_match_intro_ =
+      "Could not parse tagged union, could not match ";
+
+  static constexpr auto no_match_message_ =
+      concat<no_match_intro_.size() + _discriminator.string_view().size() +
+             2>({no_match_intro_, _discriminator.string_view(), " '"});
+
+  static constexpr std::string_view missing_intro_ =
+      "Could not parse tagged union: Could not find field '";
+
+  static constexpr std::string_view missing_outro_ =
+      "' or type of field was not a string.";
+
+  static constexpr auto missing_discriminator_message_ =
+      concat<missing_intro_.size() + _discriminator.string_view().size() +
+             missing_outro_.size()>(
+          {missing_intro_, _discriminator.string_view(), missing_outro_});
+
+  static constexpr std::string_view alternative_failed_intro_ =
+      "Could not parse tagged union with discrimininator ";
+
+  /// The beginning of the error message for every tag, without the tag
+  /// itself.
+  static constexpr auto alternative_failed_prefix_ =
+      concat<alternative_failed_intro_.size() +
+             _discriminator.string_view().size() + 2>(
+          {alternative_failed_intro_, _discriminator.string_view(), " '"});
+
+  /// The error messages for all tags, back to back.
+  static constexpr auto alternative_failed_chars_ = [] {
+    constexpr size_t size = [] {
+      size_t n = 0;
+      for (const auto& tag : tags_.keys()) {
+        n += alternative_failed_prefix_.view().size() + tag.size() + 3;
+      }
+      return n;
+    }();
+    StaticString<size> str{};
+    size_t i = 0;
+    for (const auto& tag : tags_.keys()) {
+      for (const auto part :
+           {alternative_failed_prefix_.view(), tag, std::string_view("': ")}) {
+        for (const char c : part) {
+          str.chars_[i++] = c;
+        }
+      }
+    }
+    return str;
+  }();
+
+  /// Put in front of the error if the alternative belonging to a tag fails.
+  static constexpr auto alternative_failed_messages_ = [] {
+    std::array<std::string_view, num_tags_> messages;
+    const auto all = alternative_failed_chars_.view();
+    size_t begin = 0;
+    for (size_t i = 0; i < num_tags_; ++i) {
+      const auto size =
+          alternative_failed_prefix_.view().size() + tags_.keys()[i].size() + 3;
+      messages[i] = all.substr(begin, size);
+      begin += size;
+    }
+    return messages;
+  }();
+
+  /// Parses the alternative, indexed by its position.
+  static constexpr std::array<ReadFunctionType, sizeof...(AlternativeTypes)>
+      read_functions_ = make_read_functions(
+          std::make_index_sequence<sizeof...(AlternativeTypes)>());
+
   /// Writes a wrapped version of the original object, which contains the tag.
-  template <class T>
-  static OutputVarType write_wrapped(const W& _w, const T& _val) noexcept {
+  template <class T, class P>
+  static void write_wrapped(const W& _w, const T& _val,
+                            const P& _parent) noexcept {
     const auto tag = internal::make_tag<T>();
     using TagType = std::decay_t<decltype(tag)>;
     if constexpr (internal::has_fields<std::decay_t<T>>()) {
       using WrapperType =
           TaggedUnionWrapperWithFields<T, TagType, _discriminator>;
       const auto wrapper = WrapperType{.tag = tag, .fields = &_val};
-      return Parser<R, W, WrapperType>::write(_w, wrapper);
+      Parser<R, W, WrapperType>::write(_w, wrapper, _parent);
     } else {
       using WrapperType =
           TaggedUnionWrapperNoFields<T, TagType, _discriminator>;
       const auto wrapper = WrapperType{.tag = tag, .fields = &_val};
-      return Parser<R, W, WrapperType>::write(_w, wrapper);
+      Parser<R, W, WrapperType>::write(_w, wrapper, _parent);
     }
   }
 };
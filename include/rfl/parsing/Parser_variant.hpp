@@ -1,14 +1,19 @@
 #ifndef RFL_PARSING_PARSER_VARIANT_HPP_
 #define RFL_PARSING_PARSER_VARIANT_HPP_
 
+#include <array>
 #include <type_traits>
 #include <variant>
+#include <vector>
 
 #include "rfl/Ref.hpp"
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/internal/stats/Timer.hpp"
 #include "rfl/parsing/FieldVariantParser.hpp"
 #include "rfl/parsing/Parser_base.hpp"
+#include "rfl/parsing/VariantClassifier.hpp"
+#include "rfl/parsing/supports_variant_classification.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -19,25 +24,68 @@ struct Parser<R, W, std::variant<FieldTypes...>> {
   using InputVarType = typename R::InputVarType;
   using OutputVarType = typename W::OutputVarType;
 
-  template <int _i = 0>
   static Result<std::variant<FieldTypes...>> read(
-      const R& _r, const InputVarType& _var,
-      const std::string _errors = "") noexcept {
-    if constexpr (_i == 0 &&
-                  internal::all_fields<std::tuple<FieldTypes...>>()) {
+      const R& _r, const InputVarType& _var) noexcept {
+    const auto timer =
+        internal::stats::ReadTimer<std::variant<FieldTypes...>>();
+    if constexpr (internal::all_fields<std::tuple<FieldTypes...>>()) {
       return FieldVariantParser<R, W, FieldTypes...>::read(_r, _var);
-    } else if constexpr (_i == sizeof...(FieldTypes)) {
-      return Error("Could not parse variant: " + _errors);
     } else {
+      if (classify_variants(_r)) {
+        const auto candidates = ClassifierType::find_candidates(_r, _var);
+        return read_alternatives(_r, _var, candidates);
+      }
+      CandidatesType all;
+      all.fill(true);
+      return read_alternatives(_r, _var, all);
+    }
+  }
+
+  template <class P>
+  static void write(const W& _w, const std::variant<FieldTypes...>& _variant,
+                    const P& _parent) noexcept {
+    const auto timer =
+        internal::stats::WriteTimer<std::variant<FieldTypes...>>();
+    if constexpr (internal::all_fields<std::tuple<FieldTypes...>>()) {
+      FieldVariantParser<R, W, FieldTypes...>::write(_w, _variant, _parent);
+    } else {
+      const auto handle = [&](const auto& _v) {
+        using Type = std::decay_t<decltype(_v)>;
+        Parser<R, W, Type>::write(_w, _v, _parent);
+      };
+      std::visit(handle, _variant);
+    }
+  }
+
+ private:
+  using ClassifierType = VariantClassifier<R, FieldTypes...>;
+
+  using CandidatesType = std::array<bool, sizeof...(FieldTypes)>;
+
+  /// Tries the alternatives in order, skipping those that are not
+  /// candidates.
+  template <int _i = 0>
+  static Result<std::variant<FieldTypes...>> read_alternatives(
+      const R& _r, const InputVarType& _var, const CandidatesType& _candidates,
+      std::vector<Error> _errors = std::vector<Error>()) noexcept {
+    if constexpr (_i == sizeof...(FieldTypes)) {
+      return Error::no_alternative("Could not parse variant: ",
+                                   std::move(_errors));
+    } else {
+      if (!_candidates[_i]) {
+        return read_alternatives<_i + 1>(_r, _var, _candidates,
+                                         std::move(_errors));
+      }
+
       const auto to_variant = [](auto&& _val) {
         return std::variant<FieldTypes...>(std::move(_val));
       };
 
-      const auto try_next = [&_r, _var, &_errors](const auto& _err) {
-        auto errors = _errors;
-        errors += std::string("\n" + std::to_string(_i + 1) + ") ") +
-                  internal::strings::replace_all(_err.what(), "\n", "\n    ");
-        return read<_i + 1>(_r, _var, errors);
+      const auto try_next = [&_r, _var, &_candidates,
+                             &_errors](Error&& _err) {
+        _errors.emplace_back(std::move(_err));
+        return read_alternatives<_i + 1>(_r, _var, _candidates,
+                                         std::move(_errors));
       };
 
       using AltType = std::decay_t<
@@ -49,16 +97,12 @@ struct Parser<R, W, std::variant<FieldTypes...>> {
     }
   }
 
-  static OutputVarType write(
-      const W& _w, const std::variant<FieldTypes...>& _variant) noexcept {
-    if constexpr (internal::all_fields<std::tuple<FieldTypes...>>()) {
-      return FieldVariantParser<R, W, FieldTypes...>::write(_w, _variant);
+  /// Whether the input should be classified before trying the alternatives.
+  static bool classify_variants(const R& _r) noexcept {
+    if constexpr (supports_variant_classification<R>) {
+      return _r.classify_variants();
     } else {
-      const auto handle = [&](const auto& _v) {
-        using Type = std::decay_t<decltype(_v)>;
-        return Parser<R, W, Type>::write(_w, _v);
-      };
-      return std::visit(handle, _variant);
+      return false;
     }
   }
 };
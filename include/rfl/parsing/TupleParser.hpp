@@ -6,6 +6,7 @@
 
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/parsing/Parent.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -20,6 +21,8 @@ struct TupleParser {
   using OutputArrayType = typename W::OutputArrayType;
   using OutputVarType = typename W::OutputVarType;
 
+  using ParentType = Parent<W>;
+
   static Result<std::tuple<Ts...>> read(const R& _r,
                                         const InputVarType& _var) noexcept {
     const auto to_vec = [&](auto _arr) { return _r.to_vec(_arr); };
@@ -42,11 +45,12 @@ struct TupleParser {
         .and_then(extract);
   }
 
-  static OutputVarType write(const W& _w,
-                             const std::tuple<Ts...>& _tup) noexcept {
-    auto arr = _w.new_array();
+  template <class P>
+  static void write(const W& _w, const std::tuple<Ts...>& _tup,
+                    const P& _parent) noexcept {
+    auto arr = ParentType::add_array(_w, _parent);
     to_array<0>(_w, _tup, &arr);
-    return arr;
+    _w.end_array(&arr);
   }
 
  private:
@@ -96,9 +100,8 @@ struct TupleParser {
       using NewFieldType = std::decay_t<
           typename std::tuple_element<_i, std::tuple<Ts...>>::type>;
 
-      const auto val =
-          Parser<R, W, NewFieldType>::write(_w, std::get<_i>(_tup));
-      _w.add(val, _ptr);
+      const auto new_parent = typename ParentType::Array{_ptr};
+      Parser<R, W, NewFieldType>::write(_w, std::get<_i>(_tup), new_parent);
       to_array<_i + 1>(_w, _tup, _ptr);
     }
   }
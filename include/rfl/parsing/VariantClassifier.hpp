@@ -0,0 +1,306 @@
+#ifndef RFL_PARSING_VARIANTCLASSIFIER_HPP_
+#define RFL_PARSING_VARIANTCLASSIFIER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#include "rfl/NamedTuple.hpp"
+#include "rfl/internal/StringHashTable.hpp"
+#include "rfl/internal/has_reflection_type_v.hpp"
+#include "rfl/internal/is_named_tuple.hpp"
+#include "rfl/named_tuple_t.hpp"
+#include "rfl/parsing/is_required.hpp"
+#include "rfl/parsing/is_vector_like.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// The kinds of input a value can be read from, as a bit mask.
+struct InputKind {
+  static constexpr std::uint8_t null = 1;
+  static constexpr std::uint8_t boolean = 2;
+  static constexpr std::uint8_t number = 4;
+  static constexpr std::uint8_t string = 8;
+  static constexpr std::uint8_t array = 16;
+  static constexpr std::uint8_t object = 32;
+  static constexpr std::uint8_t any = 63;
+};
+
+/// Before an untagged variant is parsed, the input is inspected to find out
+/// which alternatives could possibly match: Only those that can be read from
+/// the kind of input (object, array, string, ...) are tried and if the input
+/// is an object, it must contain all of the fields the alternative requires.
+/// The required fields are determined at compile time, so this takes a
+/// single pass over the keys of the object, no matter how many alternatives
+/// there are.
+///
+/// Any type the classifier does not know about, including types that have a
+/// custom constructor, is assumed to match any input. Custom parsers for
+/// structs (specializations of Parser<R, W, T>) are not detected, which is
+/// why the classification has to be explicitly enabled.
+template <class R, class... AlternativeTypes>
+class VariantClassifier {
+  using InputVarType = typename R::InputVarType;
+
+  static constexpr size_t num_alternatives_ = sizeof...(AlternativeTypes);
+
+  template <class T>
+  struct is_nullable : std::false_type {};
+
+  template <class T>
+  struct is_nullable<std::optional<T>> : std::true_type {
+    using Type = T;
+  };
+
+  template <class T>
+  struct is_nullable<std::shared_ptr<T>> : std::true_type {
+    using Type = T;
+  };
+
+  template <class T>
+  struct is_nullable<std::unique_ptr<T>> : std::true_type {
+    using Type = T;
+  };
+
+  template <class T>
+  struct is_string_map : std::false_type {};
+
+  template <class T>
+  struct is_string_map<std::map<std::string, T>> : std::true_type {};
+
+  template <class T>
+  struct is_string_map<std::unordered_map<std::string, T>> : std::true_type {};
+
+  template <class T>
+  struct is_std_array : std::false_type {};
+
+  template <class T, size_t _n>
+  struct is_std_array<std::array<T, _n>> : std::true_type {};
+
+  /// Whether T is read from an object using the field names of the named
+  /// tuple.
+  template <class T>
+  static consteval bool is_struct() {
+    if constexpr (R::template has_custom_constructor<T> ||
+                  internal::has_reflection_type_v<T>) {
+      return false;
+    } else {
+      return internal::is_named_tuple_v<T> ||
+             (std::is_class_v<T> && std::is_aggregate_v<T> &&
+              !is_std_array<T>::value);
+    }
+  }
+
+  /// Determines the kinds of input T can be read from.
+  template <class T>
+  static consteval std::uint8_t input_kinds() {
+    using Type = std::remove_cvref_t<T>;
+    if constexpr (R::template has_custom_constructor<Type>) {
+      return InputKind::any;
+    } else if constexpr (is_nullable<Type>::value) {
+      return InputKind::null |
+             input_kinds<typename is_nullable<Type>::Type>();
+    } else if constexpr (internal::has_reflection_type_v<Type>) {
+      return input_kinds<typename Type::ReflectionType>();
+    } else if constexpr (std::is_same<Type, bool>()) {
+      return InputKind::boolean;
+    } else if constexpr (std::is_arithmetic_v<Type>) {
+      return InputKind::number;
+    } else if constexpr (std::is_same<Type, std::string>() ||
+                         std::is_same<Type, std::string_view>() ||
+                         std::is_enum_v<Type>) {
+      return InputKind::string;
+    } else if constexpr (is_vector_like_v<Type> || is_std_array<Type>::value) {
+      return InputKind::array;
+    } else if constexpr (is_string_map<Type>::value || is_struct<Type>()) {
+      return InputKind::object;
+    } else {
+      return InputKind::any;
+    }
+  }
+
+  /// The names of the fields that must be present, if T is read from an
+  /// object.
+  template <class T>
+  static consteval auto required_fields() {
+    using Type = std::remove_cvref_t<T>;
+    if constexpr (R::template has_custom_constructor<Type>) {
+      return std::array<std::string_view, 0>();
+    } else if constexpr (internal::has_reflection_type_v<Type>) {
+      return required_fields<typename Type::ReflectionType>();
+    } else if constexpr (internal::is_named_tuple_v<Type>) {
+      return required_fields_of(static_cast<Type*>(nullptr));
+    } else if constexpr (is_struct<Type>()) {
+      return required_fields_of(static_cast<named_tuple_t<Type>*>(nullptr));
+    } else {
+      return std::array<std::string_view, 0>();
+    }
+  }
+
+  /// Only fields that must be present no matter how the named tuple is
+  /// parsed are taken into account, so empty containers are ignored.
+  template <class... FieldTypes>
+  static consteval auto required_fields_of(NamedTuple<FieldTypes...>*) {
+    constexpr size_t num_required =
+        (static_cast<size_t>(
+             is_required<typename FieldTypes::Type, true>()) +
+         ... + 0);
+    std::array<std::string_view, num_required> fields;
+    size_t i = 0;
+    ((is_required<typename FieldTypes::Type, true>()
+          ? static_cast<void>(fields[i++] = FieldTypes::name_.string_view())
+          : static_cast<void>(0)),
+     ...);
+    return fields;
+  }
+
+  template <class T>
+  struct Alternative {
+    static constexpr std::uint8_t kinds_ = input_kinds<T>();
+    static constexpr auto required_fields_ = required_fields<T>();
+  };
+
+  /// The number of required fields, if the same name is counted once for
+  /// every alternative requiring it.
+  static constexpr size_t num_fields_with_duplicates_ =
+      (Alternative<AlternativeTypes>::required_fields_.size() + ... + 0);
+
+  static consteval auto all_fields_with_duplicates() {
+    std::array<std::string_view, num_fields_with_duplicates_> all;
+    size_t i = 0;
+    const auto append = [&](const auto& _fields) {
+      for (const auto& f : _fields) {
+        all[i++] = f;
+      }
+    };
+    (append(Alternative<AlternativeTypes>::required_fields_), ...);
+    return all;
+  }
+
+  static constexpr size_t num_keys_ = [] {
+    const auto all = all_fields_with_duplicates();
+    size_t n = 0;
+    for (size_t i = 0; i < all.size(); ++i) {
+      bool is_new = true;
+      for (size_t j = 0; j < i; ++j) {
+        is_new = is_new && all[i] != all[j];
+      }
+      n += is_new ? 1 : 0;
+    }
+    return n;
+  }();
+
+  /// Every field required by any of the alternatives, each name occurring
+  /// exactly once.
+  static constexpr auto unique_keys_ = [] {
+    const auto all = all_fields_with_duplicates();
+    std::array<std::string_view, num_keys_> keys;
+    size_t n = 0;
+    for (size_t i = 0; i < all.size(); ++i) {
+      bool is_new = true;
+      for (size_t j = 0; j < n; ++j) {
+        is_new = is_new && all[i] != keys[j];
+      }
+      if (is_new) {
+        keys[n++] = all[i];
+      }
+    }
+    return keys;
+  }();
+
+  /// Maps the required fields to their position in unique_keys_.
+  static constexpr internal::StringHashTable<num_keys_> keys_ =
+      internal::StringHashTable<num_keys_>(unique_keys_);
+
+ public:
+  using CandidatesType = std::array<bool, num_alternatives_>;
+
+  /// Returns which of the alternatives could possibly be read from _var. If
+  /// none of them can, all of them are returned, so that the error message
+  /// is the same as without the classification.
+  static CandidatesType find_candidates(const R& _r,
+                                        const InputVarType& _var) noexcept {
+    const auto kind = get_kind(_r, _var);
+
+    auto candidates = CandidatesType(
+        {(Alternative<AlternativeTypes>::kinds_ & kind) != 0 ...});
+
+    if constexpr (num_keys_ != 0) {
+      if (kind == InputKind::object) {
+        const auto fields = _r.template to_fields_array<num_keys_>(
+            find_key_index, *_r.to_object(_var));
+        size_t i = 0;
+        ((candidates[i] = candidates[i] &&
+                          has_required_fields<AlternativeTypes>(fields),
+          ++i),
+         ...);
+      }
+    }
+
+    for (const bool c : candidates) {
+      if (c) {
+        return candidates;
+      }
+    }
+
+    CandidatesType all;
+    all.fill(true);
+    return all;
+  }
+
+ private:
+  /// Determines the kind of _var using nothing but the generic reader
+  /// interface. Failed casts only produce static error messages, so this
+  /// is cheap.
+  static std::uint8_t get_kind(const R& _r, const InputVarType& _var) noexcept {
+    if (_r.is_empty(_var)) {
+      return InputKind::null;
+    } else if (_r.to_object(_var)) {
+      return InputKind::object;
+    } else if (_r.to_array(_var)) {
+      return InputKind::array;
+    } else if (_r.template to_basic_type<bool>(_var)) {
+      return InputKind::boolean;
+    } else if (_r.template to_basic_type<double>(_var)) {
+      return InputKind::number;
+    } else {
+      return InputKind::string;
+    }
+  }
+
+  template <class T, class FieldsArrayType>
+  static bool has_required_fields(const FieldsArrayType& _fields) noexcept {
+    constexpr auto indices = [] {
+      constexpr auto& required = Alternative<T>::required_fields_;
+      std::array<int, required.size()> ix;
+      for (size_t i = 0; i < required.size(); ++i) {
+        ix[i] = keys_.find(required[i]);
+      }
+      return ix;
+    }();
+    for (const auto ix : indices) {
+      if (!_fields[ix]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Returns the index of the key or -1, if no alternative requires it.
+  static std::int16_t find_key_index(const std::string_view& _str) noexcept {
+    return static_cast<std::int16_t>(keys_.find(_str));
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -1,18 +1,26 @@
 #ifndef RFL_PARSING_VECTORPARSER_HPP_
 #define RFL_PARSING_VECTORPARSER_HPP_
 
-#include <stdexcept>
+#include <cstddef>
+#include <iterator>
+#include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/internal/stats/Timer.hpp"
 #include "rfl/parsing/MapParser.hpp"
+#include "rfl/parsing/Parent.hpp"
 #include "rfl/parsing/Parser_base.hpp"
 #include "rfl/parsing/is_forward_list.hpp"
 #include "rfl/parsing/is_map_like.hpp"
 #include "rfl/parsing/is_map_like_not_multimap.hpp"
 #include "rfl/parsing/is_set_like.hpp"
+#include "rfl/parsing/supports_array_size.hpp"
+#include "rfl/parsing/supports_numeric_arrays.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -31,70 +39,121 @@ struct VectorParser {
   using OutputArrayType = typename W::OutputArrayType;
   using OutputVarType = typename W::OutputVarType;
 
+  using ParentType = Parent<W>;
+
   using T = typename VecType::value_type;
 
   static Result<VecType> read(const R& _r, const InputVarType& _var) noexcept {
     if constexpr (treat_as_map()) {
       return MapParser<R, W, VecType>::read(_r, _var);
     } else {
-      const auto to_res = [&](auto&& _v) {
-        return to_result(_r, std::move(_v));
-      };
-      return _r.to_array(_var).and_then(to_res);
+      const auto timer = internal::stats::ReadTimer<VecType>();
+      if constexpr (read_as_numbers()) {
+        return read_numbers(_r, _var);
+      } else {
+        const auto to_container = [&](const auto& _arr) {
+          return read_container(_r, _arr);
+        };
+        return _r.to_array(_var).and_then(to_container);
+      }
     }
   }
 
-  static OutputVarType write(const W& _w, const VecType& _vec) noexcept {
+  template <class P>
+  static void write(const W& _w, const VecType& _vec,
+                    const P& _parent) noexcept {
     if constexpr (treat_as_map()) {
-      return MapParser<R, W, VecType>::write(_w, _vec);
+      MapParser<R, W, VecType>::write(_w, _vec, _parent);
     } else {
-      auto arr = _w.new_array();
+      const auto timer = internal::stats::WriteTimer<VecType>();
+      auto arr = ParentType::add_array(_w, _parent);
+      const auto new_parent = typename ParentType::Array{&arr};
       for (const auto& v : _vec) {
-        _w.add(Parser<R, W, std::decay_t<T>>::write(_w, v), &arr);
+        Parser<R, W, std::decay_t<T>>::write(_w, v, new_parent);
       }
-      return OutputVarType(arr);
+      _w.end_array(&arr);
     }
   }
 
  private:
-  static auto get_elem(const R& _r, auto& _v) {
-    return Parser<R, W, std::decay_t<T>>::read(_r, _v).value();
-  };
-
-  static auto get_pair(const R& _r, auto& _v) {
-    using K = std::decay_t<typename T::first_type>;
-    using V = std::decay_t<typename T::second_type>;
-    return Parser<R, W, std::decay_t<std::pair<K, V>>>::read(_r, _v).value();
+  /// Vectors of numbers are filled in a single pass, without parsing every
+  /// element separately, if the reader supports it.
+  static constexpr bool read_as_numbers() {
+    return std::is_same<VecType, std::vector<T>>() &&
+           supports_numeric_arrays<R, T>;
   }
 
-  static Result<VecType> to_container(const R& _r, InputArrayType&& _arr) {
-    auto input_vars = _r.to_vec(_arr);
+  static Result<VecType> read_numbers(const R& _r,
+                                      const InputVarType& _var) noexcept {
     VecType vec;
-    if constexpr (is_forward_list<VecType>()) {
-      for (auto it = input_vars.rbegin(); it != input_vars.rend(); ++it) {
-        vec.emplace_front(get_elem(_r, *it));
-      }
-    } else if constexpr (is_map_like<VecType>()) {
-      for (auto& v : input_vars) {
-        vec.insert(get_pair(_r, v));
-      }
-    } else if constexpr (is_set_like<VecType>()) {
-      for (auto& v : input_vars) {
-        vec.insert(get_elem(_r, v));
-      }
+    const auto get_buffer =
+        [&](const size_t _size) -> Result<std::back_insert_iterator<VecType>> {
+      vec.reserve(_size);
+      return std::back_inserter(vec);
+    };
+    auto err = _r.template read_numbers<T>(_var, get_buffer);
+    if (err) {
+      return std::move(*err);
+    }
+    return vec;
+  }
+
+  /// For map-like types, the elements are read as pairs of the key and the
+  /// value.
+  static auto read_elem(const R& _r, const InputVarType& _var) noexcept {
+    if constexpr (is_map_like<VecType>()) {
+      using K = std::decay_t<typename T::first_type>;
+      using V = std::decay_t<typename T::second_type>;
+      return Parser<R, W, std::pair<K, V>>::read(_r, _var);
     } else {
-      for (auto& v : input_vars) {
-        vec.emplace_back(get_elem(_r, v));
+      return Parser<R, W, std::decay_t<T>>::read(_r, _var);
+    }
+  }
+
+  /// Parses the elements directly from the array and inserts them into the
+  /// container. The container is reserved, if the reader knows the size of
+  /// the array and the container can be reserved.
+  static Result<VecType> read_container(const R& _r,
+                                        const InputArrayType& _arr) noexcept {
+    VecType vec;
+
+    if constexpr (supports_array_size<R> &&
+                  requires(VecType v) { v.reserve(size_t()); }) {
+      vec.reserve(_r.array_size(_arr));
+    }
+
+    auto last = begin_insertion(&vec);
+
+    const auto insert = [&](const InputVarType& _var) -> std::optional<Error> {
+      auto res = read_elem(_r, _var);
+      if (!res) {
+        return std::move(*res.error());
       }
+      if constexpr (is_forward_list<VecType>()) {
+        last = vec.emplace_after(last, std::move(*res));
+      } else if constexpr (is_map_like<VecType>() || is_set_like<VecType>()) {
+        vec.insert(std::move(*res));
+      } else {
+        vec.emplace_back(std::move(*res));
+      }
+      return std::nullopt;
+    };
+
+    auto err = _r.read_array(insert, _arr);
+    if (err) {
+      return std::move(*err);
     }
+
     return vec;
   }
 
-  static Result<VecType> to_result(const R& _r, InputArrayType&& _arr) {
-    try {
-      return to_container(_r, std::forward<InputArrayType>(_arr));
-    } catch (std::exception& e) {
-      return Error(e.what());
+  /// std::forward_list can only be extended after a given element, so we
+  /// need to keep track of the last one.
+  static auto begin_insertion(VecType* _vec) noexcept {
+    if constexpr (is_forward_list<VecType>()) {
+      return _vec->before_begin();
+    } else {
+      return nullptr;
     }
   }
 
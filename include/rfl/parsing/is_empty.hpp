@@ -0,0 +1,41 @@
+#ifndef RFL_PARSING_IS_EMPTY_HPP_
+#define RFL_PARSING_IS_EMPTY_HPP_
+
+#include <type_traits>
+
+#include "rfl/internal/has_reflection_method_v.hpp"
+#include "rfl/internal/has_reflection_type_v.hpp"
+#include "rfl/internal/is_rename.hpp"
+#include "rfl/parsing/is_required.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a value would be written as null. Fields that are not
+/// required are omitted altogether in that case. This is decided before
+/// anything is written, so the writers never have to take anything back.
+template <class T>
+bool is_empty(const T& _var) noexcept {
+  using Type = std::remove_cvref_t<T>;
+  if constexpr (std::is_pointer_v<Type>) {
+    return !_var || is_empty(*_var);
+  } else if constexpr (internal::has_reflection_type_v<Type>) {
+    if constexpr (internal::has_reflection_method_v<Type>) {
+      return is_empty(_var.reflection());
+    } else {
+      const auto& [r] = _var;
+      return is_empty(r);
+    }
+  } else if constexpr (internal::is_rename_v<Type>) {
+    return is_empty(_var.value());
+  } else if constexpr (is_never_required_v<Type>) {
+    return !_var || is_empty(*_var);
+  } else {
+    return false;
+  }
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
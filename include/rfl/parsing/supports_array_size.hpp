@@ -0,0 +1,20 @@
+#ifndef RFL_PARSING_SUPPORTSARRAYSIZE_HPP_
+#define RFL_PARSING_SUPPORTSARRAYSIZE_HPP_
+
+#include <concepts>
+#include <cstddef>
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader knows the size of an array before iterating
+/// through it, which allows the containers to be reserved.
+template <class R>
+concept supports_array_size = requires(R r, typename R::InputArrayType arr) {
+  { r.array_size(arr) } -> std::same_as<size_t>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
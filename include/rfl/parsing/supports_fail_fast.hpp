@@ -0,0 +1,18 @@
+#ifndef RFL_PARSING_SUPPORTSFAILFAST_HPP_
+#define RFL_PARSING_SUPPORTSFAILFAST_HPP_
+
+#include <concepts>
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader can be told to stop at the first error.
+template <class R>
+concept supports_fail_fast = requires(R r) {
+  { r.fail_fast() } -> std::same_as<bool>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef RFL_PARSING_SUPPORTSNUMERICARRAYS_HPP_
+#define RFL_PARSING_SUPPORTSNUMERICARRAYS_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+
+#include "rfl/Result.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader can read an entire array of numbers of type T
+/// in a single pass. The reader asks for an output iterator once it knows the
+/// number of elements, which may simply be a pointer into a buffer.
+template <class R, class T>
+concept supports_numeric_arrays =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+    requires(R r, typename R::InputVarType var,
+             std::function<rfl::Result<T*>(size_t)> get_buffer) {
+      {
+        r.template read_numbers<T>(var, get_buffer)
+        } -> std::same_as<std::optional<Error>>;
+    };
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
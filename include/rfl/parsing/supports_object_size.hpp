@@ -0,0 +1,20 @@
+#ifndef RFL_PARSING_SUPPORTSOBJECTSIZE_HPP_
+#define RFL_PARSING_SUPPORTSOBJECTSIZE_HPP_
+
+#include <concepts>
+#include <cstddef>
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader knows the number of key-value pairs in an
+/// object before iterating through it, which allows maps to be reserved.
+template <class R>
+concept supports_object_size = requires(R r, typename R::InputObjectType obj) {
+  { r.object_size(obj) } -> std::same_as<size_t>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
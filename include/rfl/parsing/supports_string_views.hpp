@@ -0,0 +1,22 @@
+#ifndef RFL_PARSING_SUPPORTSSTRINGVIEWS_HPP_
+#define RFL_PARSING_SUPPORTSSTRINGVIEWS_HPP_
+
+#include <concepts>
+#include <string_view>
+
+#include "rfl/Result.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader can look at strings without copying them,
+/// which is useful for values that are only compared and then discarded.
+template <class R>
+concept supports_string_views = requires(R r, typename R::InputVarType var) {
+  { r.to_string_view(var) } -> std::same_as<rfl::Result<std::string_view>>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
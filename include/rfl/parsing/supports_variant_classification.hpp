@@ -0,0 +1,19 @@
+#ifndef RFL_PARSING_SUPPORTSVARIANTCLASSIFICATION_HPP_
+#define RFL_PARSING_SUPPORTSVARIANTCLASSIFICATION_HPP_
+
+#include <concepts>
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader can be told to classify the input before
+/// trying the alternatives of an untagged variant.
+template <class R>
+concept supports_variant_classification = requires(R r) {
+  { r.classify_variants() } -> std::same_as<bool>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef RFL_STATS_HPP_
+#define RFL_STATS_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "rfl/internal/stats/Counters.hpp"
+
+namespace rfl {
+namespace stats {
+
+/// Whether the parsers have been compiled with REFLECTCPP_STATS. Otherwise,
+/// no counters are ever recorded and snapshot() is always empty.
+#ifdef REFLECTCPP_STATS
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+/// The counters for a single type, as returned by snapshot(). The times and
+/// allocations are cumulative, so they include everything spent on nested
+/// types. The bytes are only known for the type passed to read(...) or
+/// write(...) and are zero for nested types.
+struct TypeStats {
+  std::string type_name;
+  size_t num_reads = 0;
+  size_t num_writes = 0;
+  size_t bytes_read = 0;
+  size_t bytes_written = 0;
+  size_t allocations = 0;
+  std::chrono::nanoseconds read_time = std::chrono::nanoseconds(0);
+  std::chrono::nanoseconds write_time = std::chrono::nanoseconds(0);
+};
+
+/// Returns the current counters of all types that have been read or written,
+/// sorted by the total time spent on them in descending order.
+inline std::vector<TypeStats> snapshot() {
+  std::vector<TypeStats> result;
+  const auto add = [&](const auto _type_name, const auto* _counters) {
+    const auto load = [](const auto& _atomic) {
+      return _atomic.load(std::memory_order_relaxed);
+    };
+    result.push_back(TypeStats{
+        .type_name = std::string(_type_name),
+        .num_reads = load(_counters->num_reads_),
+        .num_writes = load(_counters->num_writes_),
+        .bytes_read = load(_counters->bytes_read_),
+        .bytes_written = load(_counters->bytes_written_),
+        .allocations = load(_counters->allocations_),
+        .read_time = std::chrono::nanoseconds(load(_counters->read_ns_)),
+        .write_time = std::chrono::nanoseconds(load(_counters->write_ns_))});
+  };
+  internal::stats::Registry::instance().for_each(add);
+  const auto by_total_time = [](const TypeStats& _a, const TypeStats& _b) {
+    return _a.read_time + _a.write_time > _b.read_time + _b.write_time;
+  };
+  std::sort(result.begin(), result.end(), by_total_time);
+  return result;
+}
+
+/// Sets all counters back to zero.
+inline void reset() {
+  const auto clear = [](const auto, auto* _counters) {
+    _counters->num_reads_ = 0;
+    _counters->num_writes_ = 0;
+    _counters->bytes_read_ = 0;
+    _counters->bytes_written_ = 0;
+    _counters->allocations_ = 0;
+    _counters->read_ns_ = 0;
+    _counters->write_ns_ = 0;
+  };
+  internal::stats::Registry::instance().for_each(clear);
+}
+
+/// reflect-cpp cannot observe allocations by itself. If you want them to be
+/// counted, call this function from your replacement of the global
+/// operator new.
+inline void record_allocation() noexcept {
+  ++internal::stats::thread_allocations();
+}
+
+}  // namespace stats
+}  // namespace rfl
+
+#endif
@@ -2,14 +2,18 @@
 #define RFL_XML_READER_HPP_
 
 #include <array>
+#include <cctype>
+#include <cstring>
 #include <exception>
 #include <map>
 #include <memory>
+#include <optional>
 #include <pugixml.hpp>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <unordered_map>
 #include <variant>
@@ -17,6 +21,7 @@
 
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/internal/strings/from_chars.hpp"
 
 namespace rfl {
 namespace xml {
@@ -63,13 +68,20 @@ struct Reader {
     return std::visit(cast, _node_or_attribute);
   }
 
+  /// Returns the first child named _name, just like
+  /// pugi::xml_node::child(...), but _name does not have to be
+  /// null-terminated.
   rfl::Result<InputVarType> get_field(
-      const std::string& _name, const InputObjectType _obj) const noexcept {
-    const auto node = _obj.node_.child(_name.c_str());
-    if (!node) {
-      return rfl::Error("Object contains no field named '" + _name + "'.");
+      const std::string_view& _name,
+      const InputObjectType _obj) const noexcept {
+    for (auto node = _obj.node_.first_child(); node;
+         node = node.next_sibling()) {
+      if (_name == node.name()) {
+        return InputVarType(node);
+      }
     }
-    return InputVarType(node);
+    return rfl::Error("Object contains no field named '" +
+                      std::string(_name) + "'.");
   }
 
   bool is_empty(const InputVarType _var) const noexcept {
@@ -81,34 +93,29 @@ struct Reader {
 
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType _var) const noexcept {
-    const auto get_value = [](const auto& _n) -> std::string {
+    const auto get_value = [](const auto& _n) -> const char* {
       using Type = std::decay_t<decltype(_n)>;
       if constexpr (std::is_same<Type, pugi::xml_node>()) {
-        return std::string(_n.child_value());
+        return _n.child_value();
       } else {
-        return std::string(_n.value());
+        return _n.value();
       }
     };
 
     if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
-      return std::visit(get_value, _var.node_or_attribute_);
+      return std::string(std::visit(get_value, _var.node_or_attribute_));
+    } else if constexpr (std::is_same<std::decay_t<T>, std::string_view>()) {
+      static_assert(rfl::always_false_v<T>,
+                    "std::string_view is not supported for XML, because the "
+                    "parsed document does not outlive the result. Please use "
+                    "std::string instead.");
     } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
-      return std::visit(get_value, _var.node_or_attribute_) == "true";
-    } else if constexpr (std::is_floating_point<std::decay_t<T>>()) {
-      const auto str = std::visit(get_value, _var.node_or_attribute_);
-      try {
-        return static_cast<T>(std::stod(str));
-      } catch (std::exception& e) {
-        return Error("Could not cast '" + std::string(str) +
-                     "' to floating point value.");
-      }
-    } else if constexpr (std::is_integral<std::decay_t<T>>()) {
-      const auto str = std::visit(get_value, _var.node_or_attribute_);
-      try {
-        return static_cast<T>(std::stoi(str));
-      } catch (std::exception& e) {
-        return Error("Could not cast '" + std::string(str) + "' to integer.");
-      }
+      return std::strcmp(std::visit(get_value, _var.node_or_attribute_),
+                         "true") == 0;
+    } else if constexpr (std::is_floating_point<std::decay_t<T>>() ||
+                         std::is_integral<std::decay_t<T>>()) {
+      return parse_number<std::decay_t<T>>(
+          std::visit(get_value, _var.node_or_attribute_));
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
@@ -165,6 +172,20 @@ struct Reader {
     return m;
   }
 
+  /// Calls _fct for each child node, until it returns an error.
+  template <class FunctionType>
+  std::optional<Error> read_object(const FunctionType& _fct,
+                                   const InputObjectType _obj) const noexcept {
+    for (auto child = _obj.node_.first_child(); child;
+         child = child.next_sibling()) {
+      auto err = _fct(std::string_view(child.name()), InputVarType(child));
+      if (err) {
+        return err;
+      }
+    }
+    return std::nullopt;
+  }
+
   rfl::Result<InputObjectType> to_object(
       const InputVarType _var) const noexcept {
     const auto wrap = [](const auto& _node) { return InputObjectType(_node); };
@@ -180,11 +201,69 @@ struct Reader {
     return vec;
   }
 
+  /// Calls _fct for each node that has the same name as the first one,
+  /// until it returns an error.
+  template <class FunctionType>
+  std::optional<Error> read_array(const FunctionType& _fct,
+                                  const InputArrayType _arr) const noexcept {
+    const auto name = _arr.node_.name();
+    for (auto node = _arr.node_; node; node = node.next_sibling(name)) {
+      auto err = _fct(InputVarType(node));
+      if (err) {
+        return err;
+      }
+    }
+    return std::nullopt;
+  }
+
   template <class T>
   rfl::Result<T> use_custom_constructor(
       const InputVarType _var) const noexcept {
     return rfl::Error("TODO");
   }
+
+ private:
+  /// Parses the number directly from the string pugixml holds. Surrounding
+  /// whitespace and a leading '+' are ignored, anything else that is not part
+  /// of the number is an error, as are numbers that do not fit into T,
+  /// including negative numbers for unsigned types.
+  template <class T>
+  static rfl::Result<T> parse_number(const char* _str) noexcept {
+    auto begin = _str;
+    auto end = _str + std::strlen(_str);
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin))) {
+      ++begin;
+    }
+    while (end != begin && std::isspace(static_cast<unsigned char>(end[-1]))) {
+      --end;
+    }
+    if (end - begin > 1 && *begin == '+' && begin[1] != '-') {
+      ++begin;
+    }
+
+    // from_chars rejects the minus sign for unsigned types, but a negative
+    // number is out of range rather than malformed.
+    const bool is_negative =
+        std::is_unsigned<T>() && end - begin > 1 && *begin == '-';
+
+    T value;
+    const auto [ptr, ec] = internal::strings::from_chars(
+        is_negative ? begin + 1 : begin, end, value);
+
+    constexpr const char* type_name =
+        std::is_floating_point<T>() ? "floating point value" : "integer";
+
+    if (ec == std::errc::result_out_of_range ||
+        (is_negative && ec == std::errc() && ptr == end && value != 0)) {
+      return Error("Could not cast '" + std::string(_str) + "' to " +
+                   type_name + ", because it is out of range.");
+    }
+    if (ec != std::errc() || ptr != end) {
+      return Error("Could not cast '" + std::string(_str) + "' to " +
+                   type_name + ".");
+    }
+    return value;
+  }
 };
 
 }  // namespace xml
@@ -1,62 +1,177 @@
 #ifndef RFL_XML_WRITER_HPP_
 #define RFL_XML_WRITER_HPP_
 
-#include <exception>
-#include <map>
 #include <pugixml.hpp>
-#include <sstream>
-#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
-#include <vector>
 
-#include "rfl/Ref.hpp"
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
-#include "rfl/xml/OutputArray.hpp"
-#include "rfl/xml/OutputNull.hpp"
-#include "rfl/xml/OutputObject.hpp"
-#include "rfl/xml/OutputValue.hpp"
+#include "rfl/internal/strings/NumberString.hpp"
 
 namespace rfl {
 namespace xml {
 
+// set_name(...) and set_value(...) with an explicit length were added in
+// pugixml 1.14.
+static_assert(PUGIXML_VERSION >= 1140,
+              "reflect-cpp requires pugixml 1.14 or higher for XML support.");
+
+/// Appends the nodes directly to the pugixml document while the parsers
+/// traverse the objects, without building an intermediate tree first.
 struct Writer {
-  using OutputArrayType = Ref<OutputArray>;
-  using OutputObjectType = Ref<OutputObject>;
-  using OutputVarType = Ref<OutputVar>;
+  static constexpr const char* XML_CONTENT = "xml_content";
+
+  struct XMLOutputArray {
+    /// The node the elements of the array are appended to.
+    pugi::xml_node parent_;
+
+    /// XML has no arrays, so every element becomes a node of this name.
+    std::string_view name_;
+  };
+
+  struct XMLOutputObject {
+    pugi::xml_node node_;
+  };
 
-  Writer() {}
+  struct XMLOutputVar {};
+
+  using OutputArrayType = XMLOutputArray;
+  using OutputObjectType = XMLOutputObject;
+  using OutputVarType = XMLOutputVar;
+
+  /// The root element is appended to _root and named _root_name.
+  Writer(pugi::xml_node* _root, const std::string_view& _root_name)
+      : root_(_root), root_name_(_root_name) {}
 
   ~Writer() = default;
 
-  void add(const OutputVarType _var, OutputArrayType* _arr) const noexcept {
-    (*_arr)->push_back(_var);
+  OutputArrayType array_as_root() const noexcept {
+    return OutputArrayType{*root_, root_name_};
+  }
+
+  OutputObjectType object_as_root() const noexcept {
+    return OutputObjectType{append_node(root_name_, *root_)};
   }
 
-  OutputVarType empty_var() const noexcept { return make_ref<OutputNull>(); }
+  OutputVarType null_as_root() const noexcept {
+    append_node(root_name_, *root_);
+    return OutputVarType{};
+  }
 
   template <class T>
-  OutputVarType from_basic_type(
-      const T& _var, const bool _is_attribute = false) const noexcept {
-    return make_ref<OutputValue<T>>(_var, _is_attribute);
+  OutputVarType value_as_root(const T& _var) const noexcept {
+    insert_value(root_name_, _var, *root_, false);
+    return OutputVarType{};
+  }
+
+  OutputArrayType add_array_to_array(OutputArrayType* _parent) const noexcept {
+    return *_parent;
+  }
+
+  OutputArrayType add_array_to_object(
+      const std::string_view& _name,
+      OutputObjectType* _parent) const noexcept {
+    return OutputArrayType{_parent->node_, _name};
   }
 
-  OutputArrayType new_array() const noexcept { return make_ref<OutputArray>(); }
+  OutputObjectType add_object_to_array(
+      OutputArrayType* _parent) const noexcept {
+    return OutputObjectType{append_node(_parent->name_, _parent->parent_)};
+  }
 
-  OutputObjectType new_object() const noexcept {
-    return make_ref<OutputObject>();
+  OutputObjectType add_object_to_object(
+      const std::string_view& _name,
+      OutputObjectType* _parent) const noexcept {
+    return OutputObjectType{append_node(_name, _parent->node_)};
   }
 
-  bool is_empty(const OutputVarType& _var) const noexcept {
-    return _var->is_null();
+  template <class T>
+  OutputVarType add_value_to_array(const T& _var,
+                                   OutputArrayType* _parent) const noexcept {
+    insert_value(_parent->name_, _var, _parent->parent_, false);
+    return OutputVarType{};
   }
 
-  void set_field(const std::string& _name, const OutputVarType& _var,
-                 OutputObjectType* _obj) const noexcept {
-    (*_obj)->push_back(_name, _var);
+  template <class T>
+  OutputVarType add_value_to_object(
+      const std::string_view& _name, const T& _var, OutputObjectType* _parent,
+      const bool _is_attribute = false) const noexcept {
+    insert_value(_name, _var, _parent->node_, _is_attribute);
+    return OutputVarType{};
   }
+
+  OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept {
+    append_node(_parent->name_, _parent->parent_);
+    return OutputVarType{};
+  }
+
+  OutputVarType add_null_to_object(const std::string_view& _name,
+                                   OutputObjectType* _parent) const noexcept {
+    append_node(_name, _parent->node_);
+    return OutputVarType{};
+  }
+
+  void end_array(OutputArrayType* _arr) const noexcept {}
+
+  void end_object(OutputObjectType* _obj) const noexcept {}
+
+ private:
+  /// The names are not necessarily null-terminated, so they are set
+  /// separately.
+  static pugi::xml_node append_node(const std::string_view& _name,
+                                    pugi::xml_node _parent) noexcept {
+    auto node = _parent.append_child(pugi::node_element);
+    node.set_name(_name.data(), _name.size());
+    return node;
+  }
+
+  /// Inserts the value as an attribute, as the content of _parent or as a
+  /// child node.
+  template <class T>
+  static void insert_value(const std::string_view& _name, const T& _var,
+                           pugi::xml_node _parent,
+                           const bool _is_attribute) noexcept {
+    using Type = std::decay_t<T>;
+    if constexpr (std::is_same<Type, std::string>() ||
+                  std::is_same<Type, std::string_view>()) {
+      insert_string(_name, _var.data(), _var.size(), _parent, _is_attribute);
+    } else if constexpr (std::is_same<Type, bool>()) {
+      const std::string_view str = _var ? "true" : "false";
+      insert_string(_name, str.data(), str.size(), _parent, _is_attribute);
+    } else if constexpr (std::is_floating_point<Type>() ||
+                         std::is_integral<Type>()) {
+      const auto str = internal::strings::NumberString(_var);
+      insert_string(_name, str.c_str(), str.view().size(), _parent,
+                    _is_attribute);
+    } else {
+      static_assert(always_false_v<T>, "Unsupported type");
+    }
+  }
+
+  static void insert_string(const std::string_view& _name, const char* _str,
+                            const size_t _size, pugi::xml_node _parent,
+                            const bool _is_attribute) noexcept {
+    if (_is_attribute) {
+      auto attr = _parent.append_attribute("");
+      attr.set_name(_name.data(), _name.size());
+      attr.set_value(_str, _size);
+    } else if (_name == XML_CONTENT) {
+      _parent.append_child(pugi::node_pcdata).set_value(_str, _size);
+    } else {
+      append_node(_name, _parent)
+          .append_child(pugi::node_pcdata)
+          .set_value(_str, _size);
+    }
+  }
+
+ private:
+  /// The node the root element is appended to.
+  pugi::xml_node* root_;
+
+  /// The name of the root element.
+  std::string_view root_name_;
 };
 
 }  // namespace xml
@@ -7,6 +7,7 @@
 
 #include "rfl/internal/get_type_name.hpp"
 #include "rfl/internal/remove_namespaces.hpp"
+#include "rfl/internal/stats/Timer.hpp"
 #include "rfl/xml/Parser.hpp"
 #include "rfl/xml/Reader.hpp"
 
@@ -31,6 +32,7 @@ Result<T> read(const std::string& _xml_str) {
     return Error("XML string could not be parsed: " +
                  std::string(result.description()));
   }
+  internal::stats::record_bytes_read<T>(_xml_str.size());
   const auto var = InputVarType(doc.first_child());
   return read<T>(var);
 }
@@ -1,16 +1,20 @@
 #ifndef RFL_XML_WRITE_HPP_
 #define RFL_XML_WRITE_HPP_
 
+#include <cstddef>
 #include <ostream>
 #include <pugixml.hpp>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 #include "rfl/internal/StringLiteral.hpp"
 #include "rfl/internal/get_type_name.hpp"
 #include "rfl/internal/remove_namespaces.hpp"
+#include "rfl/internal/stats/Timer.hpp"
+#include "rfl/parsing/Parent.hpp"
 #include "rfl/xml/Parser.hpp"
+#include "rfl/xml/Writer.hpp"
 
 namespace rfl {
 namespace xml {
@@ -25,10 +29,9 @@ consteval auto get_root_name() {
   }
 }
 
-/// Writes a XML into an ostream.
-template <internal::StringLiteral _root = internal::StringLiteral(""), class T>
-std::ostream& write(const T& _obj, std::ostream& _stream,
-                    const std::string& _indent = "    ") {
+/// Writes the declaration and the root element into the document.
+template <internal::StringLiteral _root, class T>
+void write_into_document(const T& _obj, pugi::xml_document* _doc) {
   constexpr auto root_name = get_root_name<_root, T>();
 
   static_assert(root_name.string_view().find("<") == std::string_view::npos &&
@@ -38,28 +41,47 @@ std::ostream& write(const T& _obj, std::ostream& _stream,
                 "explicit root name to rfl::xml::write(...) like this: "
                 "rfl::xml::write<\"root_name\">(...).");
 
-  auto w = Writer();
-  const auto xml_obj = Parser<T>::write(w, _obj);
-
-  pugi::xml_document doc;
-
-  auto declaration_node = doc.append_child(pugi::node_declaration);
+  auto declaration_node = _doc->append_child(pugi::node_declaration);
   declaration_node.append_attribute("version") = "1.0";
   declaration_node.append_attribute("encoding") = "UTF-8";
 
-  xml_obj->insert(root_name.str(), &doc);
+  using ParentType = parsing::Parent<Writer>;
+  pugi::xml_node root = *_doc;
+  const auto w = Writer(&root, root_name.string_view());
+  Parser<T>::write(w, _obj, typename ParentType::Root{});
+}
 
-  doc.save(_stream, _indent.c_str());
+/// Appends the output of pugixml to a string.
+struct StringWriter : public pugi::xml_writer {
+  explicit StringWriter(std::string* _str) : str_(_str) {}
 
+  void write(const void* _data, size_t _size) final {
+    str_->append(static_cast<const char*>(_data), _size);
+  }
+
+  std::string* str_;
+};
+
+/// Writes a XML into an ostream.
+template <internal::StringLiteral _root = internal::StringLiteral(""), class T>
+std::ostream& write(const T& _obj, std::ostream& _stream,
+                    const std::string& _indent = "    ") {
+  pugi::xml_document doc;
+  write_into_document<_root>(_obj, &doc);
+  doc.save(_stream, _indent.c_str());
   return _stream;
 }
 
 /// Returns a XML string.
 template <internal::StringLiteral _root = internal::StringLiteral(""), class T>
 std::string write(const T& _obj, const std::string& _indent = "    ") {
-  std::stringstream stream;
-  write<_root, T>(_obj, stream);
-  return stream.str();
+  pugi::xml_document doc;
+  write_into_document<_root>(_obj, &doc);
+  std::string xml_str;
+  auto writer = StringWriter(&xml_str);
+  doc.save(writer, _indent.c_str());
+  internal::stats::record_bytes_written<T>(xml_str.size());
+  return xml_str;
 }
 
 }  // namespace xml
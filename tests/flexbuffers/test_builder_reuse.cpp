@@ -0,0 +1,62 @@
+#include "test_builder_reuse.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+namespace test_builder_reuse {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  int age;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto people =
+      std::vector<Person>({Person{.first_name = "Bart", .age = 10},
+                           Person{.first_name = "Lisa", .age = 8},
+                           Person{.first_name = "Maggie", .age = 0}});
+
+  flexbuffers::Builder fbb;
+
+  for (const auto& person : people) {
+    rfl::flexbuf::write(person, &fbb);
+
+    const auto& buffer = fbb.GetBuffer();
+
+    const auto expected = rfl::flexbuf::write(person);
+
+    if (std::vector<char>(buffer.begin(), buffer.end()) != expected) {
+      std::cout << "Test failed on write. Content was not identical."
+                << std::endl
+                << std::endl;
+      return;
+    }
+
+    const auto res = rfl::flexbuf::read<Person>(expected);
+
+    if (!res) {
+      std::cout << "Test failed on read. Error: "
+                << res.error().value().what() << std::endl
+                << std::endl;
+      return;
+    }
+
+    if (res.value().first_name != person.first_name ||
+        res.value().age != person.age) {
+      std::cout << "Test failed on read. Values were not identical."
+                << std::endl
+                << std::endl;
+      return;
+    }
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_builder_reuse
@@ -0,0 +1,3 @@
+namespace test_builder_reuse{
+    void test();
+}
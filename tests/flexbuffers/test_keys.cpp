@@ -0,0 +1,92 @@
+#include "test_keys.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+namespace test_keys {
+
+struct Address {
+  std::string street;
+  int number;
+};
+
+struct Person {
+  rfl::Rename<"firstName", std::string> first_name;
+  std::string last_name;
+  int age;
+  Address address;
+  std::map<std::string, int> scores;
+};
+
+/// Checks that the keys in _map are exactly _expected, byte by byte. The
+/// keys are sorted by flexbuffers.
+bool check_keys(const flexbuffers::Map& _map,
+                const std::vector<std::string>& _expected) {
+  const auto keys = _map.Keys();
+  if (keys.size() != _expected.size()) {
+    std::cout << "Test failed. Expected " << _expected.size()
+              << " keys, got " << keys.size() << "." << std::endl
+              << std::endl;
+    return false;
+  }
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const auto key = std::string(keys[i].AsKey());
+    if (key != _expected[i]) {
+      std::cout << "Test failed. Expected key '" << _expected[i] << "', got '"
+                << key << "'." << std::endl
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto homer =
+      Person{.first_name = "Homer",
+             .last_name = "Simpson",
+             .age = 45,
+             .address = Address{.street = "Evergreen Terrace", .number = 742},
+             .scores = std::map<std::string, int>({{"bowling", 3}, {"a", 1}})};
+
+  const auto bytes = rfl::flexbuf::write(homer);
+
+  const auto root = flexbuffers::GetRoot(
+                        reinterpret_cast<const uint8_t*>(bytes.data()),
+                        bytes.size())
+                        .AsMap();
+
+  if (!check_keys(root,
+                  {"address", "age", "firstName", "last_name", "scores"}) ||
+      !check_keys(root["address"].AsMap(), {"number", "street"}) ||
+      !check_keys(root["scores"].AsMap(), {"a", "bowling"})) {
+    return;
+  }
+
+  const auto res = rfl::flexbuf::read<Person>(bytes);
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::flexbuf::write(res.value()) != bytes) {
+    std::cout << "Test failed. The output was not identical after reading."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_keys
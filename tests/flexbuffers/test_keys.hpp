@@ -0,0 +1,3 @@
+namespace test_keys{
+    void test();
+}
@@ -0,0 +1,59 @@
+#include "test_string_view.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <source_location>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace test_string_view {
+
+struct Event {
+  rfl::Rename<"eventId", std::string_view> event_id;
+  std::string_view tag;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto event = Event{.event_id = "e-12345", .tag = "click"};
+
+  const auto bytes = rfl::flexbuf::write(event);
+
+  const auto res = rfl::flexbuf::read<Event>(bytes);
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl;
+    return;
+  }
+
+  if (res.value().event_id() != "e-12345" || res.value().tag != "click") {
+    std::cout << "Test failed: Unexpected values." << std::endl;
+    return;
+  }
+
+  // The stream and the file are released before the caller could use the
+  // views, so both must be rejected.
+  std::stringstream stream;
+  rfl::flexbuf::write(res.value(), stream);
+
+  if (rfl::flexbuf::read<Event>(stream)) {
+    std::cout << "Test failed: Expected an error when reading from a stream."
+              << std::endl;
+    return;
+  }
+
+  rfl::flexbuf::save("event.fb", res.value());
+
+  if (rfl::flexbuf::load<Event>("event.fb")) {
+    std::cout << "Test failed: Expected an error when loading a file."
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_string_view
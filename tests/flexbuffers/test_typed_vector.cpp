@@ -0,0 +1,121 @@
+#include "test_typed_vector.hpp"
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+namespace test_typed_vector {
+
+/// rfl::flexbuf::write(...) only produces untyped vectors, so the typed
+/// vectors are built by hand. The width of the elements is the size of
+/// SourceType.
+template <class SourceType>
+std::vector<uint8_t> build_typed_vector(const std::vector<SourceType>& _source) {
+  flexbuffers::Builder fbb;
+  fbb.Vector(_source.data(), _source.size());
+  fbb.Finish();
+  return fbb.GetBuffer();
+}
+
+template <class ContainerType>
+bool check(const std::vector<uint8_t>& _buffer,
+           const ContainerType& _expected) {
+  const auto res = rfl::flexbuf::read<ContainerType>(
+      reinterpret_cast<const char*>(_buffer.data()), _buffer.size());
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return false;
+  }
+
+  if (res.value() != _expected) {
+    std::cout << "Test failed on read. Values were not identical."
+              << std::endl
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/// If TargetType has the same type and width as SourceType, the elements
+/// are copied directly from the buffer. Otherwise, they are converted one by
+/// one.
+template <class SourceType, class TargetType>
+bool read_typed_vector() {
+  const auto source = std::vector<SourceType>({1, 2, 3, 5, 8, 13, 21, 100});
+  const auto buffer = build_typed_vector(source);
+  if (!check(buffer, std::vector<TargetType>(source.begin(), source.end()))) {
+    std::cout << "Source had " << sizeof(SourceType) << " bytes, target had "
+              << sizeof(TargetType) << " bytes." << std::endl
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const bool same_layout = read_typed_vector<int8_t, int8_t>() &&
+                           read_typed_vector<int16_t, int16_t>() &&
+                           read_typed_vector<int32_t, int32_t>() &&
+                           read_typed_vector<int64_t, int64_t>() &&
+                           read_typed_vector<uint8_t, uint8_t>() &&
+                           read_typed_vector<uint16_t, uint16_t>() &&
+                           read_typed_vector<uint32_t, uint32_t>() &&
+                           read_typed_vector<uint64_t, uint64_t>() &&
+                           read_typed_vector<float, float>() &&
+                           read_typed_vector<double, double>();
+
+  const bool different_layout = read_typed_vector<int8_t, int64_t>() &&
+                                read_typed_vector<int16_t, int64_t>() &&
+                                read_typed_vector<int32_t, int64_t>() &&
+                                read_typed_vector<uint8_t, uint64_t>() &&
+                                read_typed_vector<uint16_t, uint64_t>() &&
+                                read_typed_vector<uint32_t, uint64_t>() &&
+                                read_typed_vector<uint8_t, int>() &&
+                                read_typed_vector<int32_t, uint32_t>() &&
+                                read_typed_vector<uint64_t, int64_t>() &&
+                                read_typed_vector<float, double>() &&
+                                read_typed_vector<double, float>() &&
+                                read_typed_vector<int16_t, double>();
+
+  if (!same_layout || !different_layout) {
+    return;
+  }
+
+  // std::array is filled through a pointer, so the elements are copied in a
+  // single memcpy if the layout matches.
+  const auto same =
+      build_typed_vector(std::vector<int32_t>({-1, 0, 1, 1000000}));
+  const auto different = build_typed_vector(std::vector<int16_t>({-1, 0, 1}));
+
+  if (!check(same, std::array<int32_t, 4>({-1, 0, 1, 1000000})) ||
+      !check(different, std::array<int, 3>({-1, 0, 1})) ||
+      !check(build_typed_vector(std::vector<double>({0.5, -2.25})),
+             std::array<double, 2>({0.5, -2.25}))) {
+    return;
+  }
+
+  const auto res = rfl::flexbuf::read<std::array<int32_t, 3>>(
+      reinterpret_cast<const char*>(same.data()), same.size());
+
+  if (res) {
+    std::cout << "Test failed. Expected an error, because the array has the "
+                 "wrong size."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_typed_vector
@@ -0,0 +1,3 @@
+namespace test_typed_vector{
+    void test();
+}
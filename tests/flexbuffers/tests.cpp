@@ -1,6 +1,7 @@
 #include "test_all_of.hpp"
 #include "test_anonymous_fields.hpp"
 #include "test_box.hpp"
+#include "test_builder_reuse.hpp"
 #include "test_custom_class1.hpp"
 #include "test_custom_class2.hpp"
 #include "test_custom_class3.hpp"
@@ -9,6 +10,7 @@
 #include "test_field_variant.hpp"
 #include "test_flatten_anonymous.hpp"
 #include "test_forward_list.hpp"
+#include "test_keys.hpp"
 #include "test_list.hpp"
 #include "test_literal.hpp"
 #include "test_map.hpp"
@@ -23,7 +25,9 @@
 #include "test_set.hpp"
 #include "test_string_map.hpp"
 #include "test_string_unordered_map.hpp"
+#include "test_string_view.hpp"
 #include "test_tagged_union.hpp"
+#include "test_typed_vector.hpp"
 #include "test_unique_ptr.hpp"
 #include "test_unique_ptr2.hpp"
 #include "test_unordered_map.hpp"
@@ -60,6 +64,7 @@ int main() {
   test_set::test();
   test_string_map::test();
   test_string_unordered_map::test();
+  test_string_view::test();
   test_unordered_map::test();
   test_unordered_multimap::test();
   test_unordered_multiset::test();
@@ -71,5 +76,11 @@ int main() {
 
   test_save_load::test();
 
+  test_builder_reuse::test();
+
+  test_typed_vector::test();
+
+  test_keys::test();
+
   return 0;
 }
@@ -0,0 +1,72 @@
+#include "test_array2.hpp"
+
+#include <array>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+
+#include "write_and_read.hpp"
+
+namespace test_array2 {
+
+struct Document {
+  std::array<std::string, 768> tokens;
+  std::array<float, 1536> embedding;
+  std::array<rfl::Ref<std::string>, 2> authors;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  auto doc = Document{.authors = {rfl::make_ref<std::string>("Homer"),
+                                  rfl::make_ref<std::string>("Marge")}};
+  for (size_t i = 0; i < doc.tokens.size(); ++i) {
+    doc.tokens[i] = "t" + std::to_string(i);
+  }
+  for (size_t i = 0; i < doc.embedding.size(); ++i) {
+    doc.embedding[i] = static_cast<float>(i) * 0.5f;
+  }
+
+  const auto json_string = rfl::json::write(doc);
+
+  const auto res = rfl::json::read<Document>(json_string);
+
+  if (!res) {
+    std::cout << "Could not read the document: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (res.value().tokens != doc.tokens ||
+      res.value().embedding != doc.embedding ||
+      *res.value().authors[1] != "Marge") {
+    std::cout << "The document does not match." << std::endl << std::endl;
+    return;
+  }
+
+  const auto result = rfl::json::read<std::array<rfl::Ref<std::string>, 2>>(
+      R"(["Homer","Marge","Bart"])");
+
+  const std::string expected = "Expected 2 fields, got 3.";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  write_and_read(doc.authors, R"(["Homer","Marge"])");
+}
+
+}  // namespace test_array2
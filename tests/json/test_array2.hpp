@@ -0,0 +1,3 @@
+namespace test_array2{
+    void test();
+}
@@ -0,0 +1,98 @@
+#include "test_classify_variants.hpp"
+
+#include <iostream>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace test_classify_variants {
+
+struct Person {
+  rfl::Rename<"firstName", std::string> first_name;
+  int age;
+};
+
+struct Company {
+  std::string name;
+  std::optional<std::string> website;
+  int employees;
+};
+
+struct Team {
+  std::string name;
+  Person captain;
+  std::vector<Person> members;
+};
+
+using Entity = std::variant<Person, Company, Team, std::vector<int>,
+                            std::string, int>;
+
+bool check(const std::string& _json_str, const size_t _expected_index) {
+  const auto opts = rfl::json::ReadOptions{.classify_variants = true};
+
+  const auto result = rfl::json::read<Entity>(_json_str, opts);
+
+  if (!result) {
+    std::cout << "Unexpected error: " << result.error().value().what()
+              << std::endl
+              << std::endl;
+    return false;
+  }
+
+  if (result.value().index() != _expected_index) {
+    std::cout << "Expected alternative " << _expected_index << ", got "
+              << result.value().index() << "." << std::endl
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const std::string team =
+      R"({"name":"Simpsons","captain":{"firstName":"Homer","age":45},)"
+      R"("members":[]})";
+
+  if (!check(R"({"firstName":"Homer","age":45})", 0) ||
+      !check(R"({"name":"Springfield Nuclear","employees":1000})", 1) ||
+      !check(team, 2) || !check("[1,2,3]", 3) || !check(R"("Homer")", 4) ||
+      !check("45", 5)) {
+    return;
+  }
+
+  // Company is the only alternative that requires 'employees', so it is
+  // the only one that is tried.
+  const std::string faulty_string =
+      R"({"name":"Springfield Nuclear","employees":"many"})";
+
+  const std::string expected = R"(Could not parse variant: 
+1) Failed to parse field 'employees': Could not cast to int.)";
+
+  const auto opts = rfl::json::ReadOptions{.classify_variants = true};
+
+  const auto result = rfl::json::read<Entity>(faulty_string, opts);
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_classify_variants
@@ -0,0 +1,3 @@
+namespace test_classify_variants{
+    void test();
+}
@@ -0,0 +1,60 @@
+#include "test_enum2.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+
+#include "write_and_read.hpp"
+
+namespace test_enum2 {
+
+// The values are sparse and some of them do not have a name.
+enum class Venue : unsigned char { nyse = 3, nasdaq = 42, lse = 100 };
+
+struct Trade {
+  Venue venue;
+  Venue routed_to;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto from_number =
+      rfl::json::read<Trade>(R"({"venue":"lse","routed_to":"7"})");
+
+  if (!from_number || from_number.value().venue != Venue::lse ||
+      from_number.value().routed_to != static_cast<Venue>(7)) {
+    std::cout << "Could not read the trade." << std::endl << std::endl;
+    return;
+  }
+
+  const auto result =
+      rfl::json::read<Trade>(R"({"venue":"lse","routed_to":"300"})");
+
+  const std::string expected =
+      "Failed to parse field 'routed_to': Could not parse enum: '300' is "
+      "neither one of its names nor an integer.";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto trade =
+      Trade{.venue = Venue::nasdaq, .routed_to = static_cast<Venue>(7)};
+
+  write_and_read(trade, R"({"venue":"nasdaq","routed_to":"7"})");
+}
+
+}  // namespace test_enum2
@@ -0,0 +1,3 @@
+namespace test_enum2{
+    void test();
+}
@@ -0,0 +1,66 @@
+#include "test_fail_fast.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+namespace test_fail_fast {
+
+struct Person {
+  rfl::Rename<"firstName", std::string> first_name;
+  rfl::Rename<"lastName", std::string> last_name;
+  rfl::Timestamp<"%Y-%m-%d"> birthday;
+  std::vector<Person> children;
+};
+
+// Unlike Person, this can be parsed in place.
+struct Customer {
+  rfl::Rename<"firstName", std::string> first_name;
+  int age;
+  std::vector<int> scores;
+};
+
+template <class T>
+bool check(const std::string& _json_str, const std::string& _expected) {
+  const auto opts = rfl::json::ReadOptions{.fail_fast = true};
+
+  const auto result = rfl::json::read<T>(_json_str, opts);
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return false;
+  }
+
+  if (result.error().value().what() != _expected) {
+    std::cout << "Expected: " << std::endl
+              << _expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const bool success =
+      check<Person>(
+          R"({"firstName":"Homer","lastName":12345,"birthday":"04/19/1987"})",
+          "Failed to parse field 'lastName': Could not cast to string.") &&
+      check<Customer>(R"({"firstName":12345,"age":"old"})",
+                      "Failed to parse field 'firstName': Could not cast to "
+                      "string.");
+
+  if (!success) {
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_fail_fast
@@ -0,0 +1,3 @@
+namespace test_fail_fast{
+    void test();
+}
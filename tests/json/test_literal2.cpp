@@ -0,0 +1,68 @@
+#include "test_literal2.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <string_view>
+
+namespace test_literal2 {
+
+using Status = rfl::Literal<"pending", "active", "suspended", "closed">;
+
+struct Account {
+  std::string id;
+  Status status;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto suspended = Status::from_string(std::string_view("suspended"));
+
+  if (!suspended || suspended.value().name_view() != "suspended" ||
+      suspended.value().value() != 2) {
+    std::cout << "Could not look up 'suspended'." << std::endl << std::endl;
+    return;
+  }
+
+  if (!Status::contains(std::string_view("closed")) ||
+      Status::contains(std::string_view("close"))) {
+    std::cout << "contains(...) is wrong." << std::endl << std::endl;
+    return;
+  }
+
+  const auto account =
+      rfl::json::read<Account>(R"({"id":"A-1","status":"active"})");
+
+  if (!account || account.value().status.name_view() != "active") {
+    std::cout << "Could not read the account." << std::endl << std::endl;
+    return;
+  }
+
+  const auto result =
+      rfl::json::read<Account>(R"({"id":"A-1","status":"deleted"})");
+
+  const std::string expected =
+      "Failed to parse field 'status': Literal does not support string "
+      "'deleted'. The following strings are supported: 'pending', 'active', "
+      "'suspended', 'closed'.";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_literal2
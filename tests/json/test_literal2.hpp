@@ -0,0 +1,3 @@
+namespace test_literal2{
+    void test();
+}
@@ -0,0 +1,83 @@
+#include "test_map2.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "write_and_read.hpp"
+
+namespace test_map2 {
+
+struct StringHash {
+  using is_transparent = void;
+
+  size_t operator()(std::string_view _str) const {
+    return std::hash<std::string_view>()(_str);
+  }
+};
+
+struct FeatureStore {
+  std::unordered_map<std::string, double, StringHash, std::equal_to<>>
+      features;
+  std::map<std::string, int, std::less<>> counts;
+  std::map<long, std::string> labels;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  auto store = FeatureStore{};
+  for (int i = 0; i < 1000; ++i) {
+    store.features["f" + std::to_string(i)] = i * 0.5;
+  }
+
+  const auto res = rfl::json::read<FeatureStore>(rfl::json::write(store));
+
+  if (!res) {
+    std::cout << "Could not read the store: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto it = res.value().features.find(std::string_view("f999"));
+  if (it == res.value().features.end() || it->second != 499.5) {
+    std::cout << "Could not find 'f999'." << std::endl << std::endl;
+    return;
+  }
+
+  const auto result = rfl::json::read<FeatureStore>(
+      R"({"features":{},"counts":{},"labels":{"12abc":"x"}})");
+
+  const std::string expected =
+      "Failed to parse field 'labels': Could not convert key '12abc' to an "
+      "integer.";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  write_and_read(
+      FeatureStore{.counts = {{"a", 1}, {"b", 2}},
+                   .labels = {{-3, "minus three"}, {10000000000, "large"}}},
+      R"({"features":{},"counts":{"a":1,"b":2},"labels":{"-3":"minus three","10000000000":"large"}})");
+}
+
+}  // namespace test_map2
@@ -0,0 +1,3 @@
+namespace test_map2{
+    void test();
+}
@@ -0,0 +1,129 @@
+#include "test_mapped_file.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/io/MappedFile.hpp>
+#include <rfl/io/load_bytes.hpp>
+#include <rfl/io/load_string.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace test_mapped_file {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  std::vector<double> scores;
+};
+
+#ifndef _WIN32
+/// Pipes cannot be mapped or seeked, so they have to be read as a stream.
+template <class ReadFunction>
+auto read_from_fifo(const std::string& _content, const ReadFunction& _read) {
+  const auto fname = std::string("homer_mapped.fifo");
+  unlink(fname.c_str());
+  mkfifo(fname.c_str(), 0600);
+  auto writer = std::thread([&]() { std::ofstream(fname) << _content; });
+  auto res = _read(fname);
+  writer.join();
+  unlink(fname.c_str());
+  return res;
+}
+
+bool test_special_files(const Person& _homer) {
+  const auto json_str = rfl::json::write(_homer);
+
+  const auto res = read_from_fifo(json_str, [](const std::string& _fname) {
+    return rfl::json::load<Person>(_fname);
+  });
+
+  if (!res || rfl::json::write(res.value()) != json_str) {
+    std::cout << "Test failed on load from a pipe." << std::endl;
+    return false;
+  }
+
+  const auto bytes = read_from_fifo(json_str, [](const std::string& _fname) {
+    return rfl::io::load_bytes(_fname);
+  });
+
+  if (!bytes || std::string(bytes.value().begin(), bytes.value().end()) !=
+                    json_str) {
+    std::cout << "Test failed on load_bytes from a pipe." << std::endl;
+    return false;
+  }
+
+#ifdef __linux__
+  // The files in procfs report a size of zero.
+  const auto status = rfl::io::load_string("/proc/self/status");
+
+  if (!status || status.value().find("Name:") != 0) {
+    std::cout << "Test failed on load_string from procfs." << std::endl;
+    return false;
+  }
+#endif
+
+  return true;
+}
+#endif
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto homer =
+      Person{.first_name = "Homer", .scores = std::vector<double>(1000, 0.5)};
+
+  rfl::json::save("homer_mapped.json", homer);
+
+  const auto file = rfl::io::MappedFile::open("homer_mapped.json");
+
+  if (!file || std::string_view(file.value().data(), file.value().size()) !=
+                   rfl::json::write(homer)) {
+    std::cout << "Test failed. The mapped file was not identical."
+              << std::endl;
+    return;
+  }
+
+  const auto res = rfl::json::load<Person>("homer_mapped.json");
+
+  if (!res || rfl::json::write(res.value()) != rfl::json::write(homer)) {
+    std::cout << "Test failed on load." << std::endl;
+    return;
+  }
+
+  std::ofstream("empty_mapped.json").close();
+
+  if (rfl::json::load<Person>("empty_mapped.json")) {
+    std::cout << "Test failed. An empty file must not be loaded."
+              << std::endl;
+    return;
+  }
+
+  const auto missing = rfl::json::load<Person>("does_not_exist.json");
+
+  if (missing || std::string(missing.error().value().what()) !=
+                     "Unable to open file 'does_not_exist.json' or file "
+                     "could not be found.") {
+    std::cout << "Test failed. Expected an error for a missing file."
+              << std::endl;
+    return;
+  }
+
+#ifndef _WIN32
+  if (!test_special_files(homer)) {
+    return;
+  }
+#endif
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_mapped_file
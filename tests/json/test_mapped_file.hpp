@@ -0,0 +1,3 @@
+namespace test_mapped_file{
+    void test();
+}
@@ -0,0 +1,124 @@
+#include "test_ndjson.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace test_ndjson {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  int age;
+};
+
+/// Returns _data and then fails, like a connection that is lost in the
+/// middle of a record.
+struct BrokenBuffer : std::streambuf {
+  explicit BrokenBuffer(std::string _data) : data_(std::move(_data)) {
+    setg(data_.data(), data_.data(), data_.data() + data_.size());
+  }
+
+  int_type underflow() override {
+    throw std::runtime_error("Connection lost.");
+  }
+
+  std::string data_;
+};
+
+/// A stream that fails must not be mistaken for the end of the input. The
+/// records read before the failure are returned, but the incomplete line in
+/// the chunk must not be parsed as a record.
+bool test_broken_stream() {
+  std::string data;
+  for (int i = 0; i < 3000; ++i) {
+    data +=
+        "{\"first_name\":\"Bart\",\"last_name\":\"Simpson\",\"age\":10}\n";
+  }
+  data += "{\"first_name\":\"Maggie\",\"last_name\":\"Simpson\"";
+
+  BrokenBuffer buffer(std::move(data));
+  std::istream stream(&buffer);
+
+  size_t num_records = 0;
+  std::vector<std::string> errors;
+
+  for (auto& res : rfl::json::read_stream<Person>(stream)) {
+    if (res) {
+      ++num_records;
+    } else {
+      errors.emplace_back(res.error().value().what());
+    }
+  }
+
+  if (num_records == 0 || errors.size() != 1 ||
+      errors[0] != "Could not read line " + std::to_string(num_records + 1) +
+                       " from the stream.") {
+std::cout << "Test failed. Expected the records before the failure "
+                 "and a single read error."
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto people = std::vector<Person>(
+      {Person{.first_name = "Bart", .age = 10},
+       Person{.first_name = "Lisa", .age = 8},
+       Person{.first_name = std::string(100000, 'M'), .age = 0}});
+
+  std::stringstream stream;
+
+  rfl::json::write_stream(people, stream);
+
+  stream << "\n{\"first_name\":\"Homer\",\"last_name\":\"Simpson\",\"age\":45";
+
+  std::vector<Person> result;
+  std::vector<std::string> errors;
+
+  for (auto& res : rfl::json::read_stream<Person>(stream)) {
+    if (res) {
+      result.emplace_back(std::move(*res));
+    } else {
+      errors.emplace_back(res.error().value().what());
+    }
+  }
+
+  if (result.size() != people.size()) {
+    std::cout << "Test failed. Expected " << people.size()
+              << " records, got " << result.size() << "." << std::endl;
+    return;
+  }
+
+  for (size_t i = 0; i < people.size(); ++i) {
+    if (result[i].first_name != people[i].first_name ||
+        result[i].age != people[i].age) {
+      std::cout << "Test failed. Record " << i << " was not identical."
+                << std::endl;
+      return;
+    }
+  }
+
+  if (errors.size() != 1 ||
+      errors[0].find("Could not parse JSON in line 5: ") != 0) {
+    std::cout << "Test failed. Expected an error in line 5." << std::endl;
+    return;
+  }
+
+  if (!test_broken_stream()) {
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_ndjson
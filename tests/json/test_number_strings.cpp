@@ -0,0 +1,55 @@
+#include "test_number_strings.hpp"
+
+#include <iostream>
+#include <map>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+
+#include "write_and_read.hpp"
+
+namespace test_number_strings {
+
+using Probability =
+    rfl::Validator<double, rfl::Minimum<0.0>, rfl::Maximum<1.0>>;
+
+struct Quantiles {
+  std::map<double, std::string> labels;
+  Probability coverage;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto result = rfl::json::read<Quantiles>(
+      R"({"labels":{},"coverage":1.25})");
+
+  const std::string expected =
+      "Failed to parse field 'coverage': Value expected to be less than or "
+      "equal to 1, but got 1.25.";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto quantiles =
+      Quantiles{.labels = {{0.1, "p10"}, {0.5, "median"}, {0.999, "p999"}},
+                .coverage = 0.95};
+
+  write_and_read(
+      quantiles,
+      R"({"labels":{"0.1":"p10","0.5":"median","0.999":"p999"},"coverage":0.95})");
+}
+
+}  // namespace test_number_strings
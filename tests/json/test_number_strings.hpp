@@ -0,0 +1,3 @@
+namespace test_number_strings{
+    void test();
+}
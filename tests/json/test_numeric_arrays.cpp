@@ -0,0 +1,69 @@
+#include "test_numeric_arrays.hpp"
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_numeric_arrays {
+
+struct TimeSeries {
+  std::vector<int64_t> timestamps;
+  std::vector<double> values;
+  std::array<float, 3> weights;
+};
+
+bool check_error(const std::string& _json_string,
+                 const std::string& _expected) {
+  const auto result = rfl::json::read<TimeSeries>(_json_string);
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return false;
+  }
+
+  if (result.error().value().what() != _expected) {
+    std::cout << "Expected: " << std::endl
+              << _expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const bool ok =
+      check_error(
+          R"({"timestamps":[1,2],"values":[0.5,"x"],"weights":[1,2,3]})",
+          "Failed to parse field 'values': Could not cast to double.") &&
+      check_error(
+          R"({"timestamps":[1,2.5],"values":[],"weights":[1,2,3]})",
+          "Failed to parse field 'timestamps': Could not cast to int.") &&
+      check_error(R"({"timestamps":[],"values":[],"weights":[1,2]})",
+                  "Failed to parse field 'weights': Expected 3 fields, got 2.");
+
+  if (!ok) {
+    return;
+  }
+
+  const auto series = TimeSeries{.timestamps = {1700000000000, 1700000001000},
+                                 .values = {0.5, -2.0, 3.0},
+                                 .weights = {0.25f, 0.5f, 1.0f}};
+
+  write_and_read(
+      series,
+      R"({"timestamps":[1700000000000,1700000001000],"values":[0.5,-2.0,3.0],"weights":[0.25,0.5,1.0]})");
+}
+
+}  // namespace test_numeric_arrays
@@ -0,0 +1,3 @@
+namespace test_numeric_arrays{
+    void test();
+}
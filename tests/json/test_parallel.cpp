@@ -0,0 +1,74 @@
+#include "test_parallel.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+namespace test_parallel {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  rfl::Timestamp<"%Y-%m-%d"> birthday;
+  int age;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  std::vector<Person> people;
+  for (int i = 0; i < 10000; ++i) {
+    people.push_back(Person{.first_name = "Person " + std::to_string(i),
+                            .birthday = "1987-04-19",
+                            .age = i});
+  }
+
+  const auto json_string = rfl::json::write(people);
+
+  const auto res =
+      rfl::json::read<std::vector<Person>>(json_string, rfl::Parallel{4});
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl;
+    return;
+  }
+
+  if (rfl::json::write(res.value()) != json_string) {
+    std::cout << "Test failed. Content was not identical." << std::endl;
+    return;
+  }
+
+  // Elements 7000 and 9000 are invalid for different reasons, but only the
+  // error of the first one must be returned.
+  auto broken = people;
+  broken[7000].first_name = "";
+  broken[9000].age = 123456789;
+  auto broken_string = rfl::json::write(broken);
+  broken_string.replace(broken_string.find("\"first_name\":\"\""), 15,
+                        "\"first_name\":0 ");
+  broken_string.replace(broken_string.find("\"age\":123456789"), 15,
+                        "\"age\":\"x\"");
+
+  const auto sequential = rfl::json::read<std::vector<Person>>(broken_string);
+
+  const auto parallel =
+      rfl::json::read<std::vector<Person>>(broken_string, rfl::Parallel{4});
+
+  if (sequential || parallel ||
+      std::string(sequential.error().value().what()) !=
+          std::string(parallel.error().value().what()) ||
+      std::string(parallel.error().value().what()).find("first_name") ==
+          std::string::npos) {
+    std::cout << "Test failed. Expected the same error as when parsing "
+                 "sequentially."
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_parallel
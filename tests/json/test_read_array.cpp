@@ -0,0 +1,71 @@
+#include "test_read_array.hpp"
+
+#include <deque>
+#include <forward_list>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_read_array {
+
+struct Series {
+  std::vector<int> values;
+  std::deque<double> weights;
+  std::forward_list<std::string> labels;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  auto series = Series{.weights = {0.5, 1.5}, .labels = {"a", "b", "c"}};
+  for (int i = 0; i < 10000; ++i) {
+    series.values.push_back(i);
+  }
+
+  const auto json_string = rfl::json::write(series);
+
+  const auto res = rfl::json::read<Series>(json_string);
+
+  if (!res) {
+    std::cout << "Could not read the series: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (res.value().values != series.values) {
+    std::cout << "The values do not match." << std::endl << std::endl;
+    return;
+  }
+
+  const auto result = rfl::json::read<Series>(
+      R"({"values":[1,2,"three"],"weights":[],"labels":[]})");
+
+  const std::string expected =
+      "Failed to parse field 'values': Could not cast to int.";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  write_and_read(
+      Series{.values = {1, 2, 3}, .weights = {0.5}, .labels = {"x", "y"}},
+      R"({"values":[1,2,3],"weights":[0.5],"labels":["x","y"]})");
+}
+
+}  // namespace test_read_array
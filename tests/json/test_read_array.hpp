@@ -0,0 +1,3 @@
+namespace test_read_array{
+    void test();
+}
@@ -0,0 +1,63 @@
+#include "test_read_in_place.hpp"
+
+#include <iostream>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_read_in_place {
+
+struct Address {
+  std::string street;
+  int number;
+};
+
+struct Customer {
+  rfl::Rename<"firstName", std::string> first_name;
+  std::optional<std::string> nickname;
+  Address address;
+  std::vector<int> scores;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const std::string faulty_string =
+      R"({"firstName":12345,"address":{"street":"Evergreen Terrace"}})";
+
+  const auto result = rfl::json::read<Customer>(faulty_string);
+
+  const std::string expected = R"(Found 3 errors:
+1) Failed to parse field 'firstName': Could not cast to string.
+2) Failed to parse field 'address': Field named 'number' not found.
+3) Field named 'scores' not found.)";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto customer =
+      Customer{.first_name = "Homer",
+               .address = Address{.street = "Evergreen Terrace", .number = 742},
+               .scores = {1, 2, 3}};
+
+  write_and_read(
+      customer,
+      R"({"firstName":"Homer","address":{"street":"Evergreen Terrace","number":742},"scores":[1,2,3]})");
+}
+}  // namespace test_read_in_place
@@ -0,0 +1,66 @@
+#include "test_read_options.hpp"
+
+#include <array>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test_read_options {
+
+struct Person {
+  rfl::Rename<"firstName", std::string> first_name;
+  rfl::Rename<"lastName", std::string_view> last_name;
+  std::vector<std::string> children;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const std::string expected =
+      R"({"firstName":"Homer","lastName":"Simpson","children":["Bart","Lisa","Maggie"]})";
+
+  std::array<char, 4096> pool;
+  yyjson_alc alc;
+  yyjson_alc_pool_init(&alc, pool.data(), pool.size());
+
+  const auto opts = rfl::json::ReadOptions{
+      .flags = YYJSON_READ_INSITU | YYJSON_READ_ALLOW_COMMENTS, .alc = &alc};
+
+  auto buffer = std::string(
+      R"({"firstName":"Homer", /* comment */ "lastName":"Simpson","children":["Bart","Lisa","Maggie"]})");
+  const auto size = buffer.size();
+  buffer.append(YYJSON_PADDING_SIZE, '\0');
+
+  const auto res = rfl::json::read<Person>(buffer.data(), size, opts);
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl;
+    return;
+  }
+
+  const auto json_string = rfl::json::write(res.value());
+
+  if (json_string != expected) {
+    std::cout << "Test failed on write. Expected:" << std::endl
+              << expected << std::endl
+              << "Got: " << std::endl
+              << json_string << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto err = rfl::json::read<Person>(R"({"firstName":)", opts);
+
+  if (err) {
+    std::cout << "Test failed: Expected an error." << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_read_options
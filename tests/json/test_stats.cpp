@@ -0,0 +1,97 @@
+#include "test_stats.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+namespace test_stats {
+
+struct Address {
+  std::string street;
+  int number;
+};
+
+struct Person {
+  std::string first_name;
+  std::vector<Address> addresses;
+};
+
+template <class T>
+const rfl::stats::TypeStats* find(
+    const std::vector<rfl::stats::TypeStats>& _stats) {
+  const auto type_name = rfl::type_name_t<T>().str();
+  const auto it =
+      std::find_if(_stats.begin(), _stats.end(),
+                   [&](const auto& _s) { return _s.type_name == type_name; });
+  return it == _stats.end() ? nullptr : &*it;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  rfl::stats::reset();
+
+  const auto homer = Person{
+      .first_name = "Homer",
+      .addresses = std::vector<Address>(
+          {Address{.street = "Evergreen Terrace", .number = 742},
+           Address{.street = "Spalding Way", .number = 1}})};
+
+  const auto json_string = rfl::json::write(homer);
+
+  const auto res = rfl::json::read<Person>(json_string);
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl;
+    return;
+  }
+
+  const auto stats = rfl::stats::snapshot();
+
+  if constexpr (!rfl::stats::enabled) {
+    if (!stats.empty()) {
+      std::cout << "Test failed. Expected no counters without "
+                   "REFLECTCPP_STATS."
+                << std::endl;
+      return;
+    }
+  } else {
+    const auto person = find<Person>(stats);
+    const auto address = find<Address>(stats);
+
+    if (!person || !address) {
+      std::cout << "Test failed. Could not find the counters." << std::endl;
+      return;
+    }
+
+    if (person->num_reads != 1 || person->num_writes != 1 ||
+        person->bytes_read != json_string.size() ||
+        person->bytes_written != json_string.size()) {
+      std::cout << "Test failed. Unexpected counters for Person."
+                << std::endl;
+      return;
+    }
+
+    if (address->num_reads != 2 || address->num_writes != 2 ||
+        address->bytes_read != 0 || address->bytes_written != 0) {
+      std::cout << "Test failed. Unexpected counters for Address."
+                << std::endl;
+      return;
+    }
+
+    if (person->read_time < address->read_time) {
+      std::cout << "Test failed. The time spent on Person must include the "
+                   "time spent on Address."
+                << std::endl;
+      return;
+    }
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_stats
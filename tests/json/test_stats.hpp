@@ -0,0 +1,3 @@
+namespace test_stats{
+    void test();
+}
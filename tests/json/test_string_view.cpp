@@ -0,0 +1,54 @@
+#include "test_string_view.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test_string_view {
+
+struct Event {
+  rfl::Rename<"eventId", std::string_view> event_id;
+  std::string_view tag;
+  std::vector<std::string_view> labels;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto json_string =
+      std::string(R"({"eventId":"e-12345","tag":"click","labels":["a","b\"c"]})");
+
+  const auto res = rfl::json::read_borrowed<Event>(json_string);
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl;
+    return;
+  }
+
+  const auto& event = res.value();
+
+  if (event->event_id() != "e-12345" || event->tag != "click" ||
+      event->labels.size() != 2 || event->labels[1] != "b\"c") {
+    std::cout << "Test failed: Unexpected values." << std::endl;
+    return;
+  }
+
+  const auto json_string2 = rfl::json::write(event.value());
+
+  if (json_string2 != json_string) {
+    std::cout << "Test failed on write. Expected:" << std::endl
+              << json_string << std::endl
+              << "Got: " << std::endl
+              << json_string2 << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_string_view
@@ -0,0 +1,3 @@
+namespace test_string_view{
+    void test();
+}
@@ -0,0 +1,102 @@
+#include "test_tagged_union3.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+
+namespace test_tagged_union3 {
+
+struct Login {
+  std::string user;
+};
+
+struct Logout {
+  std::string user;
+};
+
+struct Purchase {
+  std::string user;
+  double amount;
+};
+
+struct Refund {
+  std::string user;
+  double amount;
+};
+
+struct Heartbeat {
+  int sequence;
+};
+
+using Event =
+    rfl::TaggedUnion<"type", Login, Logout, Purchase, Refund, Heartbeat>;
+
+bool check(const std::string& _json_str, const size_t _expected_index) {
+  const auto result = rfl::json::read<Event>(_json_str);
+
+  if (!result) {
+    std::cout << "Unexpected error: " << result.error().value().what()
+              << std::endl
+              << std::endl;
+    return false;
+  }
+
+  if (result.value().variant_.index() != _expected_index) {
+    std::cout << "Expected alternative " << _expected_index << ", got "
+              << result.value().variant_.index() << "." << std::endl
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+bool expect_error(const std::string& _json_str, const std::string& _expected) {
+  const auto result = rfl::json::read<Event>(_json_str);
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return false;
+  }
+
+  if (result.error().value().what() != _expected) {
+    std::cout << "Expected: " << std::endl
+              << _expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  // The discriminator does not have to be the first field.
+  if (!check(R"({"user":"homer","type":"Refund","amount":2.5})", 3) ||
+      !check(R"({"type":"Login","user":"homer"})", 0) ||
+      !check(R"({"type":"Heartbeat","sequence":7})", 4) ||
+      !check(R"({"type":"Purchase","user":"homer","amount":1.0})", 2)) {
+    return;
+  }
+
+  if (!expect_error(
+          R"({"type":"Ping"})",
+          "Could not parse tagged union, could not match type 'Ping'.") ||
+      !expect_error(R"({"user":"homer"})",
+                    "Could not parse tagged union: Could not find field "
+                    "'type' or type of field was not a string.") ||
+      !expect_error(R"({"type":"Heartbeat","sequence":"seven"})",
+                    "Could not parse tagged union with discrimininator type "
+                    "'Heartbeat': Failed to parse field 'sequence': Could "
+                    "not cast to int.")) {
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_tagged_union3
@@ -0,0 +1,3 @@
+namespace test_tagged_union3{
+    void test();
+}
@@ -0,0 +1,67 @@
+#include "test_variant_error_messages.hpp"
+
+#include <iostream>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace test_variant_error_messages {
+
+struct Person {
+  std::string name;
+  int age;
+};
+
+struct Group {
+  std::vector<int> values;
+  std::optional<Person> leader;
+};
+
+using Entity = std::variant<Person, Group, int>;
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const std::string faulty_string =
+      R"({"name":1,"values":"x","leader":{"name":"Homer"}})";
+
+  const auto result = rfl::json::read<Entity>(faulty_string);
+
+  const std::string expected = R"(Could not parse variant: 
+1) Found 2 errors:
+    1) Failed to parse field 'name': Could not cast to string.
+    2) Field named 'age' not found.
+2) Found 2 errors:
+    1) Failed to parse field 'values': Could not cast to array!
+    2) Failed to parse field 'leader': Field named 'age' not found.
+3) Could not cast to int.)";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  // The message is rendered lazily, so copies must render the same message.
+  const auto error = result.error().value();
+
+  if (error.code() != rfl::Error::Code::no_alternative) {
+    std::cout << "Unexpected error code." << std::endl << std::endl;
+    return;
+  }
+
+  if (error.what() != expected || result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << error.what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_variant_error_messages
@@ -0,0 +1,3 @@
+namespace test_variant_error_messages{
+    void test();
+}
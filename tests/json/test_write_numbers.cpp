@@ -0,0 +1,48 @@
+#include "test_write_numbers.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_write_numbers {
+
+struct Numbers {
+  std::int64_t large_int;
+  std::uint64_t large_uint;
+  std::vector<double> doubles;
+  std::string text;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto numbers =
+      Numbers{.large_int = std::numeric_limits<std::int64_t>::min(),
+              .large_uint = std::numeric_limits<std::uint64_t>::max(),
+              .doubles = {0.0, 3.0, 0.1, -2.5, 123456.789, 1e20, 1e21, 1e-6,
+                          1e-7, 5e-324},
+              .text = "tab\tquote\"slash/\x01"};
+
+  std::stringstream stream;
+  rfl::json::write(numbers, stream);
+
+  if (stream.str() != rfl::json::write(numbers)) {
+    std::cout << "Test failed: Writing into a stream produced a different "
+                 "result."
+              << std::endl;
+    return;
+  }
+
+  write_and_read(
+      numbers,
+      R"({"large_int":-9223372036854775808,"large_uint":18446744073709551615,"doubles":[0.0,3.0,0.1,-2.5,123456.789,100000000000000000000.0,1e21,0.000001,1e-7,5e-324],"text":"tab\tquote\"slash/\u0001"})");
+}
+}  // namespace test_write_numbers
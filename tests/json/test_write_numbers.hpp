@@ -0,0 +1,3 @@
+namespace test_write_numbers{
+    void test();
+}
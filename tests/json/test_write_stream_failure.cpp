@@ -0,0 +1,47 @@
+#include "test_write_stream_failure.hpp"
+
+#include <ios>
+#include <iostream>
+#include <ostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <source_location>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace test_write_stream_failure {
+
+/// A stream buffer that rejects every character.
+struct FailingBuffer : std::streambuf {};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  // Large enough to be flushed several times while it is being written.
+  const auto words = std::vector<std::string>(20000, "Springfield");
+
+  FailingBuffer buffer;
+  std::ostream stream(&buffer);
+
+  rfl::json::write(words, stream);
+
+  if (stream.good()) {
+    std::cout << "Test failed. The stream should have failed." << std::endl;
+    return;
+  }
+
+  FailingBuffer buffer2;
+  std::ostream stream2(&buffer2);
+  stream2.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+
+  try {
+    rfl::json::write(words, stream2);
+    std::cout << "Test failed. Expected an exception." << std::endl;
+    return;
+  } catch (const std::ios_base::failure&) {
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+}  // namespace test_write_stream_failure
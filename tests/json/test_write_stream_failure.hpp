@@ -0,0 +1,3 @@
+namespace test_write_stream_failure{
+    void test();
+}
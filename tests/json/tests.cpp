@@ -4,10 +4,12 @@
 #include "test_anonymous_fields.hpp"
 #include "test_any_of.hpp"
 #include "test_array.hpp"
+#include "test_array2.hpp"
 #include "test_as.hpp"
 #include "test_as2.hpp"
 #include "test_as_flatten.hpp"
 #include "test_box.hpp"
+#include "test_classify_variants.hpp"
 #include "test_custom_class1.hpp"
 #include "test_custom_class2.hpp"
 #include "test_custom_class3.hpp"
@@ -17,7 +19,9 @@
 #include "test_deque.hpp"
 #include "test_email.hpp"
 #include "test_enum.hpp"
+#include "test_enum2.hpp"
 #include "test_error_messages.hpp"
+#include "test_fail_fast.hpp"
 #include "test_field_variant.hpp"
 #include "test_flag_enum.hpp"
 #include "test_flag_enum_with_int.hpp"
@@ -26,16 +30,26 @@
 #include "test_forward_list.hpp"
 #include "test_list.hpp"
 #include "test_literal.hpp"
+#include "test_literal2.hpp"
 #include "test_literal_map.hpp"
 #include "test_literal_unordered_map.hpp"
 #include "test_map.hpp"
+#include "test_map2.hpp"
 #include "test_map_with_key_validation.hpp"
+#include "test_mapped_file.hpp"
 #include "test_meta_fields.hpp"
 #include "test_monster_example.hpp"
 #include "test_multimap.hpp"
 #include "test_multiset.hpp"
+#include "test_ndjson.hpp"
+#include "test_number_strings.hpp"
+#include "test_numeric_arrays.hpp"
 #include "test_one_of.hpp"
 #include "test_optional_fields.hpp"
+#include "test_parallel.hpp"
+#include "test_read_array.hpp"
+#include "test_read_in_place.hpp"
+#include "test_read_options.hpp"
 #include "test_readme_example.hpp"
 #include "test_ref.hpp"
 #include "test_replace.hpp"
@@ -48,11 +62,14 @@
 #include "test_save_load.hpp"
 #include "test_set.hpp"
 #include "test_size.hpp"
+#include "test_stats.hpp"
 #include "test_std_ref.hpp"
 #include "test_string_map.hpp"
+#include "test_string_view.hpp"
 #include "test_string_unordered_map.hpp"
 #include "test_tagged_union.hpp"
 #include "test_tagged_union2.hpp"
+#include "test_tagged_union3.hpp"
 #include "test_timestamp.hpp"
 #include "test_unique_ptr.hpp"
 #include "test_unique_ptr2.hpp"
@@ -61,32 +78,47 @@
 #include "test_unordered_multiset.hpp"
 #include "test_unordered_set.hpp"
 #include "test_variant.hpp"
+#include "test_variant_error_messages.hpp"
 #include "test_view.hpp"
+#include "test_write_numbers.hpp"
+#include "test_write_stream_failure.hpp"
 
 int main() {
+  test_read_in_place::test();
+  test_read_options::test();
   test_readme_example::test();
   test_default_values::test();
   test_optional_fields::test();
   test_unique_ptr::test();
   test_unique_ptr2::test();
   test_literal::test();
+  test_literal2::test();
   test_enum::test();
+  test_enum2::test();
   test_flag_enum::test();
   test_flag_enum_with_int::test();
   test_variant::test();
+  test_variant_error_messages::test();
+  test_classify_variants::test();
   test_tagged_union::test();
   test_tagged_union2::test();
+  test_tagged_union3::test();
   test_field_variant::test();
   test_ref::test();
   test_box::test();
   test_array::test();
+  test_array2::test();
   test_timestamp::test();
   test_flatten::test();
   test_flatten_anonymous::test();
   test_deque::test();
   test_forward_list::test();
+  test_read_array::test();
+  test_numeric_arrays::test();
   test_list::test();
   test_map::test();
+  test_map2::test();
+  test_number_strings::test();
   test_map_with_key_validation::test();
   test_unordered_map::test();
   test_set::test();
@@ -97,12 +129,14 @@ int main() {
   test_unordered_multiset::test();
   test_std_ref::test();
   test_string_map::test();
+  test_string_view::test();
   test_string_unordered_map::test();
   test_alphanumeric_map::test();
   test_alphanumeric_unordered_map::test();
   test_literal_map::test();
   test_literal_unordered_map::test();
   test_error_messages::test();
+  test_fail_fast::test();
   test_result::test();
   test_anonymous_fields::test();
   test_monster_example::test();
@@ -132,8 +166,16 @@ int main() {
   test_size::test();
 
   test_save_load::test();
+  test_mapped_file::test();
+  test_ndjson::test();
+  test_write_stream_failure::test();
+  test_parallel::test();
+
+  test_stats::test();
 
   test_meta_fields::test();
 
+  test_write_numbers::test();
+
   return 0;
 }
@@ -0,0 +1,74 @@
+#include "test_array_size.hpp"
+
+#include <array>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/xml.hpp>
+#include <source_location>
+#include <string>
+
+namespace test_array_size {
+
+struct Triangle {
+  std::array<int, 3> corners;
+};
+
+/// XML cannot tell the size of an array up front, so the number of elements
+/// is checked while they are parsed.
+bool expect_error(const std::string& _xml, const std::string& _expected) {
+  const auto res = rfl::xml::read<Triangle>(_xml);
+
+  if (!res.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return false;
+  }
+
+  if (res.error().value().what() != _expected) {
+    std::cout << "Expected: " << std::endl
+              << _expected << std::endl
+              << "Got:" << std::endl
+              << res.error().value().what() << std::endl
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto res = rfl::xml::read<Triangle>(
+      "<Triangle><corners>1</corners><corners>2</corners><corners>3</corners>"
+      "</Triangle>");
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (res.value().corners != std::array<int, 3>({1, 2, 3})) {
+    std::cout << "Test failed on read. Values were not identical." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const bool ok =
+      expect_error(
+          "<Triangle><corners>1</corners><corners>2</corners></Triangle>",
+          "Failed to parse field 'corners': Expected 3 fields, got 2.") &&
+      expect_error(
+          "<Triangle><corners>1</corners><corners>2</corners><corners>3"
+          "</corners><corners>4</corners></Triangle>",
+          "Failed to parse field 'corners': Expected 3 fields, got 4.");
+
+  if (!ok) {
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+
+}  // namespace test_array_size
@@ -0,0 +1,3 @@
+namespace test_array_size{
+    void test();
+}
@@ -0,0 +1,126 @@
+#include "test_numbers.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/xml.hpp>
+#include <source_location>
+#include <string>
+
+#include "write_and_read.hpp"
+
+namespace test_numbers {
+
+struct Reading {
+  rfl::Attribute<int64_t> timestamp;
+  rfl::Attribute<uint8_t> channel;
+  rfl::Attribute<double> value;
+  float weight;
+};
+
+/// Reads _xml and checks that it fails with _expected.
+bool expect_error(const std::string& _xml, const std::string& _expected) {
+  const auto result = rfl::xml::read<Reading>(_xml);
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return false;
+  }
+
+  if (result.error().value().what() != _expected) {
+    std::cout << "Expected: " << std::endl
+              << _expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto res = rfl::xml::read<Reading>(
+      R"(<Reading timestamp="1700000000000" channel="7" value="0.1"><weight> 2.5 </weight></Reading>)");
+
+  if (!res) {
+    std::cout << "Could not read the reading: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (res.value().timestamp() != 1700000000000 ||
+      res.value().channel() != 7 || res.value().value() != 0.1 ||
+      res.value().weight != 2.5f) {
+    std::cout << "The reading does not match." << std::endl << std::endl;
+    return;
+  }
+
+  // Whitespace, a leading '+' and "-0" for unsigned fields are accepted,
+  // floating point values may have an exponent.
+  const auto res2 = rfl::xml::read<Reading>(
+      R"(<Reading timestamp=" +42 " channel="-0" value=" -2.5e-3 "><weight>+0.25</weight></Reading>)");
+
+  if (!res2) {
+    std::cout << "Could not read the reading: " << res2.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (res2.value().timestamp() != 42 || res2.value().channel() != 0 ||
+      res2.value().value() != -2.5e-3 || res2.value().weight != 0.25f) {
+    std::cout << "The second reading does not match." << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (!expect_error(
+          R"(<Reading timestamp=" +-5" channel="7" value="0"><weight>0</weight></Reading>)",
+          "Failed to parse field 'timestamp': Could not cast ' +-5' to "
+          "integer.")) {
+    return;
+  }
+
+  if (!expect_error(
+          R"(<Reading timestamp="0" channel="7" value="1e400"><weight>0</weight></Reading>)",
+          "Failed to parse field 'value': Could not cast '1e400' to floating "
+          "point value, because it is out of range.")) {
+    return;
+  }
+
+  if (!expect_error(
+          R"(<Reading timestamp="0" channel="7" value="0"><weight>+-5</weight></Reading>)",
+          "Failed to parse field 'weight': Could not cast '+-5' to floating "
+          "point value.")) {
+    return;
+  }
+
+  if (!expect_error(
+          R"(<Reading timestamp="0" channel="300" value="0"><weight>0</weight></Reading>)",
+          "Failed to parse field 'channel': Could not cast '300' to integer, "
+          "because it is out of range.")) {
+    return;
+  }
+
+  if (!expect_error(
+          R"(<Reading timestamp="0" channel="-1" value="0"><weight>0</weight></Reading>)",
+          "Failed to parse field 'channel': Could not cast '-1' to integer, "
+          "because it is out of range.")) {
+    return;
+  }
+
+  if (!expect_error(
+          R"(<Reading timestamp="0" channel="7" value="0"><weight>2.5kg</weight></Reading>)",
+          "Failed to parse field 'weight': Could not cast '2.5kg' to floating "
+          "point value.")) {
+    return;
+  }
+
+  write_and_read(res.value());
+}
+
+}  // namespace test_numbers
@@ -0,0 +1,3 @@
+namespace test_numbers{
+    void test();
+}
@@ -0,0 +1,63 @@
+#include "test_write_output.hpp"
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/xml.hpp>
+#include <source_location>
+#include <string>
+#include <vector>
+
+namespace test_write_output {
+
+struct Child {
+  rfl::Attribute<std::string> name;
+  rfl::Attribute<int> age;
+  std::string xml_content;
+};
+
+struct Person {
+  rfl::Rename<"firstName", rfl::Attribute<std::string>> first_name;
+  bool active;
+  double height;
+  std::vector<int> scores;
+  std::vector<Child> child;
+};
+
+void test() {
+  std::cout << std::source_location::current().function_name() << std::endl;
+
+  const auto homer =
+      Person{.first_name = "Homer",
+             .active = true,
+             .height = 1.5,
+             .scores = std::vector<int>({1, -2}),
+             .child = std::vector<Child>(
+                 {Child{.name = "Bart", .age = 10, .xml_content = "A & B"}})};
+
+  // The writer appends the nodes to the pugixml document directly, the
+  // output must be exactly the same as before.
+  const std::string expected = R"(<?xml version="1.0" encoding="UTF-8"?>
+<Person firstName="Homer">
+    <active>true</active>
+    <height>1.5</height>
+    <scores>1</scores>
+    <scores>-2</scores>
+    <child name="Bart" age="10">A &amp; B</child>
+</Person>
+)";
+
+  const auto xml_string = rfl::xml::write<"Person">(homer);
+
+  if (xml_string != expected) {
+    std::cout << "Test failed. Expected:" << std::endl
+              << expected << std::endl
+              << "Got: " << std::endl
+              << xml_string << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
+
+}  // namespace test_write_output
@@ -1,4 +1,5 @@
 #include "test_array.hpp"
+#include "test_array_size.hpp"
 #include "test_attributes.hpp"
 #include "test_box.hpp"
 #include "test_custom_class1.hpp"
@@ -18,6 +19,7 @@
 #include "test_map.hpp"
 #include "test_map_with_key_validation.hpp"
 #include "test_monster_example.hpp"
+#include "test_numbers.hpp"
 #include "test_readme_example.hpp"
 #include "test_ref.hpp"
 #include "test_save_load.hpp"
@@ -28,6 +30,7 @@
 #include "test_unique_ptr.hpp"
 #include "test_unique_ptr2.hpp"
 #include "test_variant.hpp"
+#include "test_write_output.hpp"
 #include "test_xml_content.hpp"
 
 int main() {
@@ -41,6 +44,7 @@ int main() {
   test_flag_enum_with_int::test();
   test_map::test();
   test_map_with_key_validation::test();
+  test_numbers::test();
   test_variant::test();
   test_field_variant::test();
   test_tagged_union::test();
@@ -56,12 +60,14 @@ int main() {
   test_unique_ptr::test();
   test_unique_ptr2::test();
   test_array::test();
+  test_array_size::test();
   test_box::test();
   test_custom_class1::test();
   test_custom_class3::test();
   test_custom_class4::test();
   test_default_values::test();
   test_save_load::test();
+  test_write_output::test();
 
   return 0;
 }